@@ -31,8 +31,14 @@ template <typename Data>
 bool DictionaryContainer<Data>::RemoveAll(const TraversableContainer<Data>& container) {
   bool result = true;
 
-  container.Traverse([this, &result](const Data& data) {
+  // Una volta svuotato il dizionario, nessuna rimozione successiva puo' riuscire
+  container.TraverseWhile([this, &result](const Data& data) {
+    if (this->Empty()) {
+      result = false;
+      return false;
+    }
     result &= this->Remove(data);
+    return true;
   });
 
   return result;
@@ -64,8 +70,12 @@ template <typename Data>
 bool DictionaryContainer<Data>::RemoveSome(const TraversableContainer<Data>& container) {
   bool result = false;
 
-  container.Traverse([this, &result](const Data& data) {
+  container.TraverseWhile([this, &result](const Data& data) {
+    if (this->Empty()) {
+      return false;
+    }
     result |= this->Remove(data);
+    return true;
   });
 
   return result;
@@ -75,6 +85,9 @@ bool DictionaryContainer<Data>::RemoveSome(const TraversableContainer<Data>& con
 
 // Specific member functions
 
+// Le versioni NRemove sono pure: una versione generica potrebbe solo rimuovere per chiave conservando
+// una copia, quindi ogni implementazione sposta il dato fuori dalla propria struttura
+
 template <typename Data>
 void OrderedDictionaryContainer<Data>::RemoveMin() {
   if (this->Empty()) {
@@ -84,17 +97,6 @@ void OrderedDictionaryContainer<Data>::RemoveMin() {
   this->Remove(this->Min());
 }
 
-template <typename Data>
-Data OrderedDictionaryContainer<Data>::MinNRemove() {
-  if (this->Empty()) {
-    throw std::length_error("Empty container");
-  }
-
-  Data min = this->Min();
-  this->Remove(min);
-  return min;
-}
-
 template <typename Data>
 void OrderedDictionaryContainer<Data>::RemoveMax() {
   if (this->Empty()) {
@@ -105,39 +107,53 @@ void OrderedDictionaryContainer<Data>::RemoveMax() {
 }
 
 template <typename Data>
-Data OrderedDictionaryContainer<Data>::MaxNRemove() {
-  if (this->Empty()) {
-    throw std::length_error("Empty container");
-  }
+void OrderedDictionaryContainer<Data>::RemovePredecessor(const Data& data) {
+  this->Remove(this->Predecessor(data));
+}
 
-  Data max = this->Max();
-  this->Remove(max);
-  return max;
+template <typename Data>
+void OrderedDictionaryContainer<Data>::RemoveSuccessor(const Data& data) {
+  this->Remove(this->Successor(data));
 }
 
+// Heterogeneous lookup
+
 template <typename Data>
-void OrderedDictionaryContainer<Data>::RemovePredecessor(const Data& data) {
-  this->Remove(this->Predecessor(data));
+template <typename Key> requires HeterogeneousKey<Key, Data>
+bool DictionaryContainer<Data>::Remove(const Key& key) {
+  return RemoveKey(this->MakeKeyProbe(key));
 }
 
 template <typename Data>
-Data OrderedDictionaryContainer<Data>::PredecessorNRemove(const Data& data) {
-  Data predecessor = this->Predecessor(data);
-  this->Remove(predecessor);
-  return predecessor;
+template <typename Key> requires HeterogeneousKey<Key, Data>
+const Data& OrderedDictionaryContainer<Data>::Predecessor(const Key& key) const {
+  const Data* predecessor = TryPredecessorKey(this->MakeKeyProbe(key));
+  if (predecessor == nullptr) {
+    throw std::length_error(this->Empty() ? "Empty set" : "Predecessor not found");
+  }
+  return *predecessor;
 }
 
 template <typename Data>
-void OrderedDictionaryContainer<Data>::RemoveSuccessor(const Data& data) {
-  this->Remove(this->Successor(data));
+template <typename Key> requires HeterogeneousKey<Key, Data>
+const Data& OrderedDictionaryContainer<Data>::Successor(const Key& key) const {
+  const Data* successor = TrySuccessorKey(this->MakeKeyProbe(key));
+  if (successor == nullptr) {
+    throw std::length_error(this->Empty() ? "Empty set" : "Successor not found");
+  }
+  return *successor;
 }
 
 template <typename Data>
-Data OrderedDictionaryContainer<Data>::SuccessorNRemove(const Data& data) {
-  Data successor = this->Successor(data);
-  this->Remove(successor);
-  return successor;
+template <typename Key> requires HeterogeneousKey<Key, Data>
+const Data* OrderedDictionaryContainer<Data>::TryPredecessor(const Key& key) const {
+  return TryPredecessorKey(this->MakeKeyProbe(key));
 }
 
+template <typename Data>
+template <typename Key> requires HeterogeneousKey<Key, Data>
+const Data* OrderedDictionaryContainer<Data>::TrySuccessor(const Key& key) const {
+  return TrySuccessorKey(this->MakeKeyProbe(key));
+}
 
-}
\ No newline at end of file
+}
@@ -59,6 +59,18 @@ namespace lasd {
         virtual bool RemoveSome(const TraversableContainer<Data> &);
 
         // From TraversableContainer; True if some is removed
+
+        // Heterogeneous lookup (see HeterogeneousKey)
+
+        using TestableContainer<Data>::Exists;
+
+        template<typename Key> requires HeterogeneousKey<Key, Data>
+        bool Remove(const Key &); // Removes the element equivalent to the key
+
+    protected:
+        using typename TestableContainer<Data>::KeyProbe;
+
+        virtual bool RemoveKey(const KeyProbe &) = 0;
     };
 
 
@@ -92,17 +104,17 @@ namespace lasd {
         // Specific member functions
 
         virtual const Data &Min() const = 0; // (concrete function must throw std::length_error when empty)
-        virtual Data MinNRemove(); // (concrete function must throw std::length_error when empty)
+        virtual Data MinNRemove() = 0; // Moves the element out (concrete function must throw std::length_error when empty)
         virtual void RemoveMin(); // (concrete function must throw std::length_error when empty)
 
         virtual const Data &Max() const = 0; // (concrete function must throw std::length_error when empty)
-        virtual Data MaxNRemove(); // (concrete function must throw std::length_error when empty)
+        virtual Data MaxNRemove() = 0; // Moves the element out (concrete function must throw std::length_error when empty)
         virtual void RemoveMax(); // (concrete function must throw std::length_error when empty)
 
         virtual const Data &Predecessor(const Data &) const = 0;
 
         // (concrete function must throw std::length_error when not found)
-        virtual Data PredecessorNRemove(const Data &);
+        virtual Data PredecessorNRemove(const Data &) = 0; // Moves the element out
 
         // (concrete function must throw std::length_error when not found)
         virtual void RemovePredecessor(const Data &); // (concrete function must throw std::length_error when not found)
@@ -110,8 +122,39 @@ namespace lasd {
         virtual const Data &Successor(const Data &) const = 0;
 
         // (concrete function must throw std::length_error when not found)
-        virtual Data SuccessorNRemove(const Data &); // (concrete function must throw std::length_error when not found)
+        virtual Data SuccessorNRemove(const Data &) = 0; // Moves the element out (concrete function must throw std::length_error when not found)
         virtual void RemoveSuccessor(const Data &); // (concrete function must throw std::length_error when not found)
+
+        // Non-throwing lookups: nullptr when the container is empty or nothing is found
+
+        virtual const Data *TryMin() const noexcept = 0;
+
+        virtual const Data *TryMax() const noexcept = 0;
+
+        virtual const Data *TryPredecessor(const Data &) const = 0;
+
+        virtual const Data *TrySuccessor(const Data &) const = 0;
+
+        // Heterogeneous lookup (see HeterogeneousKey)
+
+        template<typename Key> requires HeterogeneousKey<Key, Data>
+        const Data &Predecessor(const Key &) const; // (must throw std::length_error when not found)
+
+        template<typename Key> requires HeterogeneousKey<Key, Data>
+        const Data &Successor(const Key &) const; // (must throw std::length_error when not found)
+
+        template<typename Key> requires HeterogeneousKey<Key, Data>
+        const Data *TryPredecessor(const Key &) const;
+
+        template<typename Key> requires HeterogeneousKey<Key, Data>
+        const Data *TrySuccessor(const Key &) const;
+
+    protected:
+        using typename DictionaryContainer<Data>::KeyProbe;
+
+        virtual const Data *TryPredecessorKey(const KeyProbe &) const = 0; // Greatest element before the key
+
+        virtual const Data *TrySuccessorKey(const KeyProbe &) const = 0; // Smallest element after the key
     };
 }
 
@@ -11,10 +11,20 @@ bool LinearContainer<Data>::operator==(const LinearContainer<Data>& other) const
     return false;
   }
 
+  const Data* thisData = ContiguousData();
+  const Data* otherData = other.ContiguousData();
+  if (thisData != nullptr && otherData != nullptr) {
+    return std::equal(thisData, thisData + this->Size(), otherData);
+  }
+
+  Cursor thisCursor = CursorAt(0);
+  Cursor otherCursor = other.CursorAt(0);
   for (ulong i = 0; i < this->Size(); i++) {
-    if ((*this)[i] != other[i]) {
+    if (CursorData(thisCursor) != other.CursorData(otherCursor)) {
       return false;
     }
+    CursorNext(thisCursor);
+    other.CursorNext(otherCursor);
   }
 
   return true;
@@ -25,6 +35,80 @@ bool LinearContainer<Data>::operator!=(const LinearContainer<Data>& other) const
   return !(*this == other);
 }
 
+// Specific member functions
+
+template <typename Data>
+const Data* LinearContainer<Data>::TryFront() const noexcept {
+  return this->Empty() ? nullptr : &(*this)[0];
+}
+
+template <typename Data>
+const Data* LinearContainer<Data>::TryBack() const noexcept {
+  return this->Empty() ? nullptr : &(*this)[this->Size() - 1];
+}
+
+template <typename Data>
+std::size_t LinearContainer<Data>::Hash() const requires HashableData<Data> {
+  if (!hashValid) {
+    hashValue = ComputeHash();
+    hashValid = true;
+  }
+  return hashValue;
+}
+
+// Auxiliary member functions
+
+template <typename Data>
+std::size_t LinearContainer<Data>::ElementHash(const Data& data) noexcept {
+  if constexpr (HashableData<Data>) {
+    return MixHash(static_cast<std::size_t>(std::hash<Data>{}(data)));
+  } else {
+    return 0;
+  }
+}
+
+template <typename Data>
+std::size_t LinearContainer<Data>::ComputeHash() const {
+  std::size_t hash = 0;
+  Cursor cursor = CursorAt(0);
+  for (ulong i = 0; i < this->Size(); i++) {
+    hash = CombineHash(hash, ElementHash(CursorData(cursor)));
+    CursorNext(cursor);
+  }
+  return hash;
+}
+
+template <typename Data>
+void LinearContainer<Data>::HashAppended(const Data& data) noexcept {
+  if (hashValid) {
+    hashValue = CombineHash(hashValue, ElementHash(data));
+  }
+}
+
+template <typename Data>
+void LinearContainer<Data>::HashInserted(const Data&) noexcept {
+  hashValid = false;
+}
+
+template <typename Data>
+void LinearContainer<Data>::HashRemoved(const Data&) noexcept {
+  hashValid = false;
+}
+
+template <typename Data>
+std::vector<const Data*> LinearContainer<Data>::CollectElements() const {
+  std::vector<const Data*> elements;
+  elements.reserve(this->Size());
+
+  Cursor cursor = CursorAt(0);
+  for (ulong i = 0; i < this->Size(); i++) {
+    elements.push_back(&CursorData(cursor));
+    CursorNext(cursor);
+  }
+
+  return elements;
+}
+
 // Specific member function (inherited from TraversableContainer)
 
 template <typename Data>
@@ -32,22 +116,72 @@ void LinearContainer<Data>::Traverse(TraverseFun fun) const {
   PreOrderTraverse(fun);
 }
 
+template <typename Data>
+bool LinearContainer<Data>::TraverseWhile(TraverseWhileFun fun) const {
+  return PreOrderTraverseWhile(fun);
+}
+
+template <typename Data>
+template <TraverseCallable<Data> Fun>
+void LinearContainer<Data>::Traverse(Fun&& fun) const {
+  PreOrderTraverse(TraverseFun(std::ref(fun)));
+}
+
 // Specific member function (inherited from PreOrderTraversableContainer)
 
 template <typename Data>
 void LinearContainer<Data>::PreOrderTraverse(TraverseFun fun) const {
+  Cursor cursor = CursorAt(0);
+  for (ulong i = 0; i < this->Size(); i++) {
+    fun(CursorData(cursor));
+    CursorNext(cursor);
+  }
+}
+
+template <typename Data>
+template <TraverseCallable<Data> Fun>
+void LinearContainer<Data>::PreOrderTraverse(Fun&& fun) const {
+  PreOrderTraverse(TraverseFun(std::ref(fun)));
+}
+
+template <typename Data>
+bool LinearContainer<Data>::PreOrderTraverseWhile(TraverseWhileFun fun) const {
+  Cursor cursor = CursorAt(0);
   for (ulong i = 0; i < this->Size(); i++) {
-    fun((*this)[i]);
+    if (!fun(CursorData(cursor))) {
+      return false;
+    }
+    CursorNext(cursor);
   }
+  return true;
 }
 
 // Specific member function (inherited from PostOrderTraversableContainer)
 
 template <typename Data>
 void LinearContainer<Data>::PostOrderTraverse(TraverseFun fun) const {
-  for (ulong i = this->Size(); i > 0; i--) {
-    fun((*this)[i - 1]);
+  // Il cursore avanza solo in avanti: si raccolgono i riferimenti e li si visita a ritroso
+  std::vector<const Data*> elements = CollectElements();
+  for (ulong i = elements.size(); i > 0; i--) {
+    fun(*elements[i - 1]);
+  }
+}
+
+template <typename Data>
+template <TraverseCallable<Data> Fun>
+void LinearContainer<Data>::PostOrderTraverse(Fun&& fun) const {
+  PostOrderTraverse(TraverseFun(std::ref(fun)));
+}
+
+template <typename Data>
+bool LinearContainer<Data>::PostOrderTraverseWhile(TraverseWhileFun fun) const {
+  std::vector<const Data*> elements = CollectElements();
+  for (ulong i = elements.size(); i > 0; i--) {
+    if (!fun(*elements[i - 1])) {
+      return false;
+    }
   }
+  return true;
 }
 
 // Specific member function (inherited from TraversableContainer)
@@ -58,6 +192,24 @@ Accumulator LinearContainer<Data>::Fold(FoldFun<Accumulator> fun, const Accumula
   return PreOrderFold(fun, accum);
 }
 
+template <typename Data>
+template <typename Accumulator, typename Fun> requires FoldCallable<Fun, Data, Accumulator>
+Accumulator LinearContainer<Data>::Fold(Fun&& fun, const Accumulator& accum) const {
+  return PreOrderFold<Accumulator>(std::forward<Fun>(fun), accum);
+}
+
+template <typename Data>
+template <typename Accumulator>
+Accumulator LinearContainer<Data>::FoldWhile(FoldWhileFun<Accumulator> fun, const Accumulator& accum) const {
+  return PreOrderFoldWhile(fun, accum);
+}
+
+template <typename Data>
+template <typename Accumulator, typename Fun> requires FoldMoveCallable<Fun, Data, Accumulator>
+Accumulator LinearContainer<Data>::FoldMove(Fun&& fun, Accumulator accum) const {
+  return this->template PreOrderFoldMove<Accumulator>(std::forward<Fun>(fun), std::move(accum));
+}
+
 // Specific member function (inherited from PreOrderTraversableContainer)
 
 template <typename Data>
@@ -65,13 +217,39 @@ template <typename Accumulator>
 Accumulator LinearContainer<Data>::PreOrderFold(FoldFun<Accumulator> fun, const Accumulator& accum) const {
   Accumulator accumulator = accum;
 
+  Cursor cursor = CursorAt(0);
   for (ulong i = 0; i < this->Size(); i++) {
-    accumulator = fun((*this)[i], accumulator);
+    accumulator = fun(CursorData(cursor), accumulator);
+    CursorNext(cursor);
   }
 
   return accumulator;
 }
 
+template <typename Data>
+template <typename Accumulator, typename Fun> requires FoldCallable<Fun, Data, Accumulator>
+Accumulator LinearContainer<Data>::PreOrderFold(Fun&& fun, const Accumulator& accum) const {
+  Accumulator accumulator = accum;
+
+  PreOrderTraverse(TraverseFun([&accumulator, &fun](const Data& data) {
+    accumulator = fun(data, accumulator);
+  }));
+
+  return accumulator;
+}
+
+template <typename Data>
+template <typename Accumulator>
+Accumulator LinearContainer<Data>::PreOrderFoldWhile(FoldWhileFun<Accumulator> fun, const Accumulator& accum) const {
+  Accumulator accumulator = accum;
+
+  PreOrderTraverseWhile([&accumulator, &fun](const Data& data) {
+    return fun(data, accumulator);
+  });
+
+  return accumulator;
+}
+
 // Specific member function (inherited from PostOrderTraversableContainer)
 
 template <typename Data>
@@ -79,8 +257,133 @@ template <typename Accumulator>
 Accumulator LinearContainer<Data>::PostOrderFold(FoldFun<Accumulator> fun, const Accumulator& accum) const {
   Accumulator accumulator = accum;
 
-  for (ulong i = this->Size(); i > 0; i--) {
-    accumulator = fun((*this)[i - 1], accumulator);
+  PostOrderTraverse([&accumulator, &fun](const Data& data) {
+    accumulator = fun(data, accumulator);
+  });
+
+  return accumulator;
+}
+
+template <typename Data>
+template <typename Accumulator, typename Fun> requires FoldCallable<Fun, Data, Accumulator>
+Accumulator LinearContainer<Data>::PostOrderFold(Fun&& fun, const Accumulator& accum) const {
+  Accumulator accumulator = accum;
+
+  PostOrderTraverse(TraverseFun([&accumulator, &fun](const Data& data) {
+    accumulator = fun(data, accumulator);
+  }));
+
+  return accumulator;
+}
+
+template <typename Data>
+template <typename Accumulator>
+Accumulator LinearContainer<Data>::PostOrderFoldWhile(FoldWhileFun<Accumulator> fun, const Accumulator& accum) const {
+  Accumulator accumulator = accum;
+
+  PostOrderTraverseWhile([&accumulator, &fun](const Data& data) {
+    return fun(data, accumulator);
+  });
+
+  return accumulator;
+}
+
+// Range-restricted traversal and fold
+
+template <typename Data>
+void LinearContainer<Data>::CheckRange(ulong from, ulong to) const {
+  if (from > to || to > this->Size()) {
+    throw std::out_of_range("Range out of bounds");
+  }
+}
+
+template <typename Data>
+void LinearContainer<Data>::TraverseRange(ulong from, ulong to, TraverseFun fun) const {
+  PreOrderTraverseRange(from, to, fun);
+}
+
+template <typename Data>
+void LinearContainer<Data>::PreOrderTraverseRange(ulong from, ulong to, TraverseFun fun) const {
+  CheckRange(from, to);
+
+  // Un solo posizionamento su from, poi avanzamento sequenziale
+  Cursor cursor = CursorAt(from);
+  for (ulong i = from; i < to; i++) {
+    fun(CursorData(cursor));
+    CursorNext(cursor);
+  }
+}
+
+template <typename Data>
+void LinearContainer<Data>::PostOrderTraverseRange(ulong from, ulong to, TraverseFun fun) const {
+  CheckRange(from, to);
+
+  std::vector<const Data*> elements;
+  elements.reserve(to - from);
+
+  Cursor cursor = CursorAt(from);
+  for (ulong i = from; i < to; i++) {
+    elements.push_back(&CursorData(cursor));
+    CursorNext(cursor);
+  }
+
+  for (ulong i = elements.size(); i > 0; i--) {
+    fun(*elements[i - 1]);
+  }
+}
+
+template <typename Data>
+template <typename Accumulator>
+Accumulator LinearContainer<Data>::FoldRange(ulong from, ulong to, FoldFun<Accumulator> fun, const Accumulator& accum) const {
+  return PreOrderFoldRange(from, to, fun, accum);
+}
+
+template <typename Data>
+template <typename Accumulator>
+Accumulator LinearContainer<Data>::PreOrderFoldRange(ulong from, ulong to, FoldFun<Accumulator> fun, const Accumulator& accum) const {
+  Accumulator accumulator = accum;
+  PreOrderTraverseRange(from, to, [&accumulator, &fun](const Data& data) {
+    accumulator = fun(data, accumulator);
+  });
+  return accumulator;
+}
+
+template <typename Data>
+template <typename Accumulator>
+Accumulator LinearContainer<Data>::PostOrderFoldRange(ulong from, ulong to, FoldFun<Accumulator> fun, const Accumulator& accum) const {
+  Accumulator accumulator = accum;
+  PostOrderTraverseRange(from, to, [&accumulator, &fun](const Data& data) {
+    accumulator = fun(data, accumulator);
+  });
+  return accumulator;
+}
+
+// Lockstep fold
+
+template <typename Data>
+template <typename Accumulator, typename Fun> requires ZipFoldCallable<Fun, Data, Accumulator>
+Accumulator LinearContainer<Data>::ZipFold(const LinearContainer<Data>& other, Fun&& fun, const Accumulator& acc) const {
+  if (this->Size() != other.Size()) {
+    throw std::length_error("ZipFold on containers of different size");
+  }
+
+  Accumulator accumulator = acc;
+
+  const Data* thisData = ContiguousData();
+  const Data* otherData = other.ContiguousData();
+  if (thisData != nullptr && otherData != nullptr) {
+    for (ulong i = 0; i < this->Size(); i++) {
+      accumulator = fun(thisData[i], otherData[i], accumulator);
+    }
+    return accumulator;
+  }
+
+  Cursor thisCursor = CursorAt(0);
+  Cursor otherCursor = other.CursorAt(0);
+  for (ulong i = 0; i < this->Size(); i++) {
+    accumulator = fun(CursorData(thisCursor), other.CursorData(otherCursor), accumulator);
+    CursorNext(thisCursor);
+    other.CursorNext(otherCursor);
   }
 
   return accumulator;
@@ -97,21 +400,110 @@ void MutableLinearContainer<Data>::Map(MapFun fun) {
   PreOrderMap(fun);
 }
 
+template <typename Data>
+template <MapCallable<Data> Fun>
+void MutableLinearContainer<Data>::Map(Fun&& fun) {
+  PreOrderMap(MapFun(std::ref(fun)));
+}
+
 // Specific member function (inherited from PreOrderMappableContainer)
 
+template <typename Data>
+template <MapCallable<Data> Fun>
+void MutableLinearContainer<Data>::PreOrderMap(Fun&& fun) {
+  PreOrderMap(MapFun(std::ref(fun)));
+}
+
 template <typename Data>
 void MutableLinearContainer<Data>::PreOrderMap(MapFun fun) {
+  this->InvalidateHash();
+  Cursor cursor = this->CursorAt(0);
   for (ulong i = 0; i < this->Size(); i++) {
-    fun((*this)[i]);
+    fun(CursorMutableData(cursor));
+    this->CursorNext(cursor);
   }
 }
 
 // Specific member function (inherited from PostOrderMappableContainer)
 
+template <typename Data>
+template <MapCallable<Data> Fun>
+void MutableLinearContainer<Data>::PostOrderMap(Fun&& fun) {
+  PostOrderMap(MapFun(std::ref(fun)));
+}
+
 template <typename Data>
 void MutableLinearContainer<Data>::PostOrderMap(MapFun fun) {
-  for (ulong i = this->Size(); i > 0; i--) {
-    fun((*this)[i - 1]);
+  this->InvalidateHash();
+  std::vector<Data*> elements;
+  elements.reserve(this->Size());
+
+  Cursor cursor = this->CursorAt(0);
+  for (ulong i = 0; i < this->Size(); i++) {
+    elements.push_back(&CursorMutableData(cursor));
+    this->CursorNext(cursor);
+  }
+
+  for (ulong i = elements.size(); i > 0; i--) {
+    fun(*elements[i - 1]);
+  }
+}
+
+// Lockstep map
+
+template <typename Data>
+template <ZipMapCallable<Data> Fun>
+void MutableLinearContainer<Data>::ZipMap(const LinearContainer<Data>& other, Fun&& fun) {
+  if (this->Size() != other.Size()) {
+    throw std::length_error("ZipMap on containers of different size");
+  }
+
+  this->InvalidateHash();
+
+  Cursor thisCursor = this->CursorAt(0);
+  Cursor otherCursor = other.CursorAt(0);
+  for (ulong i = 0; i < this->Size(); i++) {
+    fun(CursorMutableData(thisCursor), other.CursorData(otherCursor));
+    this->CursorNext(thisCursor);
+    other.CursorNext(otherCursor);
+  }
+}
+
+// Range-restricted map
+
+template <typename Data>
+void MutableLinearContainer<Data>::MapRange(ulong from, ulong to, MapFun fun) {
+  PreOrderMapRange(from, to, fun);
+}
+
+template <typename Data>
+void MutableLinearContainer<Data>::PreOrderMapRange(ulong from, ulong to, MapFun fun) {
+  this->CheckRange(from, to);
+  this->InvalidateHash();
+
+  Cursor cursor = this->CursorAt(from);
+  for (ulong i = from; i < to; i++) {
+    fun(CursorMutableData(cursor));
+    this->CursorNext(cursor);
+  }
+}
+
+template <typename Data>
+void MutableLinearContainer<Data>::PostOrderMapRange(ulong from, ulong to, MapFun fun) {
+  this->CheckRange(from, to);
+  this->InvalidateHash();
+
+  std::vector<Data*> elements;
+  elements.reserve(to - from);
+
+  Cursor cursor = this->CursorAt(from);
+  for (ulong i = from; i < to; i++) {
+    elements.push_back(&CursorMutableData(cursor));
+    this->CursorNext(cursor);
+  }
+
+  for (ulong i = elements.size(); i > 0; i--) {
+    fun(*elements[i - 1]);
   }
 }
 
@@ -121,8 +513,8 @@ void MutableLinearContainer<Data>::PostOrderMap(MapFun fun) {
 
 // Protected member functions
 
-template <typename Data>
-void SortableLinearContainer<Data>::QuickSort(ulong left, ulong right) {
+template <typename Data, typename Compare>
+void SortableLinearContainer<Data, Compare>::QuickSort(ulong left, ulong right) {
   if (left < right) {
     ulong pivot = Partition(left, right);
     
@@ -134,27 +526,35 @@ void SortableLinearContainer<Data>::QuickSort(ulong left, ulong right) {
   }
 }
 
-template <typename Data>
-ulong SortableLinearContainer<Data>::Partition(ulong left, ulong right) {
+template <typename Data, typename Compare>
+ulong SortableLinearContainer<Data, Compare>::Partition(ulong left, ulong right) {
   ulong pivotIndex = left + (right - left) / 2;
-  Data pivotValue = (*this)[pivotIndex];
-  
-  // Sposta il pivot alla fine
-  std::swap((*this)[pivotIndex], (*this)[right]);
-  
-  ulong storeIndex = left;
-  
+  Cursor pivotCursor = this->CursorAt(pivotIndex);
+  Cursor rightCursor = this->CursorAt(right);
+
+  // Sposta il pivot alla fine (resta in posizione right fino allo scambio finale)
+  std::swap(this->CursorMutableData(pivotCursor), this->CursorMutableData(rightCursor));
+  const Data& pivotValue = this->CursorData(rightCursor);
+
+  Cursor storeCursor = this->CursorAt(left);
+  Cursor scanCursor = storeCursor;
+
   for (ulong i = left; i < right; i++) {
-    if ((*this)[i] <= pivotValue) {
-      std::swap((*this)[i], (*this)[storeIndex]);
-      storeIndex++;
+    if (compare(this->CursorData(scanCursor), pivotValue) <= 0) {
+      if (scanCursor.index != storeCursor.index) {
+        std::swap(this->CursorMutableData(scanCursor), this->CursorMutableData(storeCursor));
+      }
+      this->CursorNext(storeCursor);
     }
+    this->CursorNext(scanCursor);
   }
-  
+
   // Sposta il pivot alla sua posizione finale
-  std::swap((*this)[storeIndex], (*this)[right]);
-  
-  return storeIndex;
+  if (storeCursor.index != right) {
+    std::swap(this->CursorMutableData(storeCursor), this->CursorMutableData(rightCursor));
+  }
+
+  return storeCursor.index;
 }
 
 /* ************************************************************************** */
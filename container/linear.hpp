@@ -3,6 +3,10 @@
 
 /* ************************************************************************** */
 
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
 #include "mappable.hpp"
 
 /* ************************************************************************** */
@@ -11,10 +15,94 @@ namespace lasd {
 
 /* ************************************************************************** */
 
+// Callables accepted by the lockstep algorithms over two linear containers
+
+template <typename Fun, typename Data, typename Accumulator>
+concept ZipFoldCallable = std::is_invocable_r_v<Accumulator, Fun&, const Data&, const Data&, const Accumulator&>;
+
+template <typename Fun, typename Data>
+concept ZipMapCallable = std::invocable<Fun&, Data&, const Data&>;
+
+// Predicates accepted by the in-place RemoveIf of the concrete containers
+template <typename Fun, typename Data>
+concept RemovePredicate = std::predicate<Fun&, const Data&>;
+
+/* ************************************************************************** */
+
+// Content hashing: element types hashable with std::hash, and the mixing steps used by Hash
+
+template <typename Data>
+concept HashableData = requires(const Data& data) {
+  { std::hash<Data>{}(data) } -> std::convertible_to<std::size_t>;
+};
+
+inline std::size_t MixHash(std::size_t value) noexcept { // Finalizzatore di splitmix64
+  value ^= value >> 30;
+  value *= static_cast<std::size_t>(0xbf58476d1ce4e5b9ULL);
+  value ^= value >> 27;
+  value *= static_cast<std::size_t>(0x94d049bb133111ebULL);
+  value ^= value >> 31;
+  return value;
+}
+
+inline std::size_t CombineHash(std::size_t seed, std::size_t value) noexcept { // Dipende dall'ordine
+  return MixHash(seed ^ (value + static_cast<std::size_t>(0x9e3779b97f4a7c15ULL) + (seed << 6) + (seed >> 2)));
+}
+
+/* ************************************************************************** */
+
 template <typename Data>
 class LinearContainer : virtual public PreOrderTraversableContainer<Data>,
                        virtual public PostOrderTraversableContainer<Data> {
 
+  template <typename> friend class MutableLinearContainer; // ZipMap walks the other operand with its cursor
+
+protected:
+
+  // Auxiliary member functions
+
+  // Pointer to the first element when the storage is a single contiguous array, nullptr otherwise
+  virtual const Data* ContiguousData() const noexcept {
+    return nullptr;
+  }
+
+  // Sequential cursor: the generic algorithms walk the container with O(1) steps instead of
+  // indexing, so linked implementations (which override these functions) stay linear
+  struct Cursor {
+    void* position = nullptr; // Implementation-defined (e.g. the current node)
+    ulong index = 0;
+  };
+
+  virtual Cursor CursorAt(ulong index) const { // Default: plain index, valid for random-access storage
+    return Cursor{nullptr, index};
+  }
+
+  virtual const Data& CursorData(const Cursor& cursor) const {
+    return (*this)[cursor.index];
+  }
+
+  virtual void CursorNext(Cursor& cursor) const {
+    cursor.index++;
+  }
+
+  std::vector<const Data*> CollectElements() const; // Element addresses in pre-order, for reverse visits
+
+  void CheckRange(ulong from, ulong to) const; // Throws std::out_of_range unless from <= to <= size
+
+  // Content hash cache (see Hash): every mutation either updates hashValue or drops it
+  mutable std::size_t hashValue = 0;
+  mutable bool hashValid = false;
+
+  static std::size_t ElementHash(const Data&) noexcept; // Mixed std::hash of an element (0 if Data is not hashable)
+
+  virtual std::size_t ComputeHash() const; // From scratch: hash of the sequence, in order
+
+  // Single-element updates: a sequence extends its hash with an appended element and drops it on
+  // any other change; sets override them with the order-independent update
+  virtual void HashAppended(const Data&) noexcept;
+  virtual void HashInserted(const Data&) noexcept;
+  virtual void HashRemoved(const Data&) noexcept;
+
 public:
 
   // Destructor
@@ -44,6 +132,21 @@ public:
 
   virtual const Data& Back() const = 0; // (non-mutable version; concrete function must throw std::length_error when empty)
 
+  // Non-throwing access: nullptr when the container is empty
+  virtual const Data* TryFront() const noexcept;
+
+  virtual const Data* TryBack() const noexcept;
+
+  // Hash of the contents, consistent with operator== within a container type; cached until the next
+  // mutation, so repeated calls on an unchanged container are O(1). Every mutable accessor drops the
+  // cache when called, so a write through a reference or iterator obtained before Hash() is not seen:
+  // call InvalidateHash() after such a write (or take the reference again after hashing)
+  std::size_t Hash() const requires HashableData<Data>;
+
+  void InvalidateHash() noexcept { // Drops the cached hash: the next Hash() recomputes it
+    hashValid = false;
+  }
+
   /* ************************************************************************ */
 
   // Specific member function (inherited from TraversableContainer)
@@ -52,18 +155,35 @@ public:
 
   void Traverse(TraverseFun) const override; // Override TraversableContainer member
 
+  using typename TraversableContainer<Data>::TraverseWhileFun;
+
+  bool TraverseWhile(TraverseWhileFun) const override; // Override TraversableContainer member
+
+  template <TraverseCallable<Data> Fun>
+  void Traverse(Fun&& fun) const;
+
   /* ************************************************************************ */
 
   // Specific member function (inherited from PreOrderTraversableContainer)
 
   void PreOrderTraverse(TraverseFun) const override; // Override PreOrderTraversableContainer member
 
+  bool PreOrderTraverseWhile(TraverseWhileFun) const override; // Override PreOrderTraversableContainer member
+
+  template <TraverseCallable<Data> Fun>
+  void PreOrderTraverse(Fun&& fun) const;
+
   /* ************************************************************************ */
 
   // Specific member function (inherited from PostOrderTraversableContainer)
 
   void PostOrderTraverse(TraverseFun) const override; // Override PostOrderTraversableContainer member
 
+  bool PostOrderTraverseWhile(TraverseWhileFun) const override; // Override PostOrderTraversableContainer member
+
+  template <TraverseCallable<Data> Fun>
+  void PostOrderTraverse(Fun&& fun) const;
+
   /* ************************************************************************** */
 
   // Specific member function (inherited from TraversableContainer)
@@ -74,6 +194,18 @@ public:
   template <typename Accumulator>
   Accumulator Fold(FoldFun<Accumulator>, const Accumulator&) const; // Non implementare qui, usa linear.cpp
 
+  template <typename Accumulator, typename Fun> requires FoldCallable<Fun, Data, Accumulator>
+  Accumulator Fold(Fun&&, const Accumulator&) const;
+
+  template <typename Accumulator>
+  using FoldWhileFun = typename TraversableContainer<Data>::template FoldWhileFun<Accumulator>;
+
+  template <typename Accumulator>
+  Accumulator FoldWhile(FoldWhileFun<Accumulator>, const Accumulator&) const;
+
+  template <typename Accumulator, typename Fun> requires FoldMoveCallable<Fun, Data, Accumulator>
+  Accumulator FoldMove(Fun&&, Accumulator) const;
+
   /* ************************************************************************** */
 
   // Specific member function (inherited from PreOrderTraversableContainer)
@@ -81,6 +213,12 @@ public:
   template <typename Accumulator>
   Accumulator PreOrderFold(FoldFun<Accumulator>, const Accumulator&) const; // Non implementare qui, usa linear.cpp
 
+  template <typename Accumulator, typename Fun> requires FoldCallable<Fun, Data, Accumulator>
+  Accumulator PreOrderFold(Fun&&, const Accumulator&) const;
+
+  template <typename Accumulator>
+  Accumulator PreOrderFoldWhile(FoldWhileFun<Accumulator>, const Accumulator&) const;
+
   /* ************************************************************************** */
 
   // Specific member function (inherited from PostOrderTraversableContainer)
@@ -88,6 +226,41 @@ public:
   template <typename Accumulator>
   Accumulator PostOrderFold(FoldFun<Accumulator>, const Accumulator&) const; // Non implementare qui, usa linear.cpp
 
+  template <typename Accumulator, typename Fun> requires FoldCallable<Fun, Data, Accumulator>
+  Accumulator PostOrderFold(Fun&&, const Accumulator&) const;
+
+  template <typename Accumulator>
+  Accumulator PostOrderFoldWhile(FoldWhileFun<Accumulator>, const Accumulator&) const;
+
+  /* ************************************************************************** */
+
+  // Lockstep fold over two containers of the same size (must throw std::length_error otherwise)
+
+  template <typename Accumulator>
+  using ZipFoldFun = std::function<Accumulator(const Data&, const Data&, const Accumulator&)>;
+
+  template <typename Accumulator, typename Fun> requires ZipFoldCallable<Fun, Data, Accumulator>
+  Accumulator ZipFold(const LinearContainer&, Fun&&, const Accumulator&) const;
+
+  /* ************************************************************************** */
+
+  // Range-restricted traversal and fold over the positions [from, to) (must throw std::out_of_range on an invalid range)
+
+  void TraverseRange(ulong from, ulong to, TraverseFun) const;
+
+  virtual void PreOrderTraverseRange(ulong from, ulong to, TraverseFun) const;
+
+  virtual void PostOrderTraverseRange(ulong from, ulong to, TraverseFun) const;
+
+  template <typename Accumulator>
+  Accumulator FoldRange(ulong from, ulong to, FoldFun<Accumulator>, const Accumulator&) const;
+
+  template <typename Accumulator>
+  Accumulator PreOrderFoldRange(ulong from, ulong to, FoldFun<Accumulator>, const Accumulator&) const;
+
+  template <typename Accumulator>
+  Accumulator PostOrderFoldRange(ulong from, ulong to, FoldFun<Accumulator>, const Accumulator&) const;
+
 };
 
 /* ************************************************************************** */
@@ -97,6 +270,15 @@ class MutableLinearContainer : virtual public LinearContainer<Data>,
                               virtual public PreOrderMappableContainer<Data>,
                               virtual public PostOrderMappableContainer<Data> {
 
+protected:
+
+  // Auxiliary member functions
+
+  using typename LinearContainer<Data>::Cursor;
+
+  virtual Data& CursorMutableData(const Cursor& cursor) {
+    return (*this)[cursor.index];
+  }
 
 public:
 
@@ -133,31 +315,65 @@ public:
 
   void Map(MapFun) override; // Override MappableContainer member
 
+  template <MapCallable<Data> Fun>
+  void Map(Fun&& fun);
+
   /* ************************************************************************ */
 
   // Specific member function (inherited from PreOrderMappableContainer)
 
   void PreOrderMap(MapFun) override; // Override PreOrderMappableContainer member
 
+  template <MapCallable<Data> Fun>
+  void PreOrderMap(Fun&& fun);
+
   /* ************************************************************************ */
 
   // Specific member function (inherited from PostOrderMappableContainer)
 
   void PostOrderMap(MapFun) override; // Override PostOrderMappableContainer member
 
+  template <MapCallable<Data> Fun>
+  void PostOrderMap(Fun&& fun);
+
+  /* ************************************************************************ */
+
+  // Lockstep map: fun(element, corresponding element of the other container) (must throw std::length_error on size mismatch)
+
+  using ZipMapFun = std::function<void(Data&, const Data&)>;
+
+  template <ZipMapCallable<Data> Fun>
+  void ZipMap(const LinearContainer<Data>&, Fun&&);
+
+  /* ************************************************************************ */
+
+  // Range-restricted map over the positions [from, to) (must throw std::out_of_range on an invalid range)
+
+  void MapRange(ulong from, ulong to, MapFun);
+
+  virtual void PreOrderMapRange(ulong from, ulong to, MapFun);
+
+  virtual void PostOrderMapRange(ulong from, ulong to, MapFun);
+
 };
 
 /* ************************************************************************** */
 
-template <typename Data>
+template <typename Data, typename Compare = ThreeWayCompare>
 class SortableLinearContainer : virtual public MutableLinearContainer<Data> {
 
+  static_assert(ThreeWayComparator<Compare, Data>, "SortableLinearContainer needs a three-way comparator for Data");
+
 private:
 
   // ...
 
 protected:
 
+  using typename LinearContainer<Data>::Cursor;
+
+  [[no_unique_address]] Compare compare {}; // Ordering used by Sort (one three-way comparison per step)
+
   // Auxiliary member functions
   virtual void QuickSort(ulong, ulong);
   virtual ulong Partition(ulong, ulong);
@@ -180,6 +396,7 @@ public:
   // Specific member function
 
   virtual void Sort() {
+    this->InvalidateHash();
     if (this->Size() > 1) {
       QuickSort(0, this->Size() - 1);
     }
@@ -191,6 +408,22 @@ public:
 
 }
 
+/* ************************************************************************** */
+
+// std::hash for every concrete linear container (and set) of hashable data
+
+template <typename Container>
+  requires std::derived_from<Container, lasd::Container> && requires(const Container& container) {
+    { container.Hash() } -> std::same_as<std::size_t>;
+  }
+struct std::hash<Container> {
+  std::size_t operator()(const Container& container) const {
+    return container.Hash();
+  }
+};
+
+/* ************************************************************************** */
+
 #include "linear.cpp"
 
 #endif
\ No newline at end of file
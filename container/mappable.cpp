@@ -2,6 +2,18 @@ namespace lasd {
 
     /* ************************************************************************** */
 
+    // MappableContainer
+
+    // Generic callables are forwarded by reference to the virtual entry point
+
+    template <typename Data>
+    template <MapCallable<Data> Fun>
+    void MappableContainer<Data>::Map(Fun&& fun) {
+        Map(MapFun(std::ref(fun)));
+    }
+
+    /* ************************************************************************** */
+
     // PreOrderMappableContainer
 
     // Specific member function (inherited from MappableContainer)
@@ -11,6 +23,20 @@ namespace lasd {
         PreOrderMap(fun);
     }
 
+    template <typename Data>
+    template <MapCallable<Data> Fun>
+    void PreOrderMappableContainer<Data>::Map(Fun&& fun) {
+        PreOrderMap(std::forward<Fun>(fun));
+    }
+
+    // Specific member function
+
+    template <typename Data>
+    template <MapCallable<Data> Fun>
+    void PreOrderMappableContainer<Data>::PreOrderMap(Fun&& fun) {
+        PreOrderMap(MapFun(std::ref(fun)));
+    }
+
     // PostOrderMappableContainer
 
     // Specific member function (inherited from MappableContainer)
@@ -20,6 +46,20 @@ namespace lasd {
         PostOrderMap(fun);
     }
 
+    template <typename Data>
+    template <MapCallable<Data> Fun>
+    void PostOrderMappableContainer<Data>::Map(Fun&& fun) {
+        PostOrderMap(std::forward<Fun>(fun));
+    }
+
+    // Specific member function
+
+    template <typename Data>
+    template <MapCallable<Data> Fun>
+    void PostOrderMappableContainer<Data>::PostOrderMap(Fun&& fun) {
+        PostOrderMap(MapFun(std::ref(fun)));
+    }
+
     /* ************************************************************************** */
 
 }
\ No newline at end of file
@@ -15,6 +15,14 @@ namespace lasd {
 
 /* ************************************************************************** */
 
+// Callables accepted by the templated Map overloads
+
+template <typename Fun, typename Data>
+concept MapCallable = std::invocable<Fun&, Data&> &&
+                      !std::same_as<std::remove_cvref_t<Fun>, std::function<void(Data&)>>;
+
+/* ************************************************************************** */
+
 template <typename Data>
 class MappableContainer : virtual public TraversableContainer<Data> {
 
@@ -46,6 +54,9 @@ public:
 
   virtual void Map(MapFun) = 0;
 
+  template <MapCallable<Data> Fun>
+  void Map(Fun&& fun);
+
 };
 
 /* ************************************************************************** */
@@ -81,12 +92,18 @@ public:
 
   virtual void PreOrderMap(MapFun) = 0;
 
+  template <MapCallable<Data> Fun>
+  void PreOrderMap(Fun&& fun);
+
   /* ************************************************************************ */
 
   // Specific member function (inherited from MappableContainer)
 
   void Map(MapFun) override; // Override MappableContainer member
 
+  template <MapCallable<Data> Fun>
+  void Map(Fun&& fun);
+
 };
 
 /* ************************************************************************** */
@@ -123,12 +140,18 @@ public:
 
   virtual void PostOrderMap(MapFun) = 0;
 
+  template <MapCallable<Data> Fun>
+  void PostOrderMap(Fun&& fun);
+
   /* ************************************************************************ */
 
   // Specific member function (inherited from MappableContainer)
 
   void Map(MapFun) override; // Override MappableContainer member
 
+  template <MapCallable<Data> Fun>
+  void Map(Fun&& fun);
+
 };
 
 /* ************************************************************************** */
@@ -4,7 +4,21 @@ namespace lasd {
 
     // TestableContainer
 
-    // No implementations required for TestableContainer since all methods are pure virtual or defaulted
+    // Heterogeneous lookup
+
+    template <typename Data>
+    template <typename Key> requires HeterogeneousKey<Key, Data>
+    bool TestableContainer<Data>::Exists(const Key& key) const {
+        return ExistsKey(MakeKeyProbe(key));
+    }
+
+    template <typename Data>
+    template <typename Key>
+    typename TestableContainer<Data>::KeyProbe TestableContainer<Data>::MakeKeyProbe(const Key& key) noexcept {
+        return [&key](const Data& data) -> std::weak_ordering {
+            return ThreeWayCompare()(data, key);
+        };
+    }
 
     /* ************************************************************************** */
 
@@ -3,6 +3,13 @@
 
 /* ************************************************************************** */
 
+#include <compare>
+#include <concepts>
+#include <functional>
+#include <type_traits>
+
+/* ************************************************************************** */
+
 #include "container.hpp"
 
 /* ************************************************************************** */
@@ -11,6 +18,51 @@ namespace lasd {
 
   /* ************************************************************************** */
 
+  // Default ordering: a single operator<=> per comparison when available (synthesized from operator<
+  // otherwise); transparent, so that it also orders Data against heterogeneous keys
+
+  struct ThreeWayCompare {
+    template <typename Left, typename Right>
+    constexpr std::weak_ordering operator()(const Left& left, const Right& right) const {
+      if constexpr (std::three_way_comparable_with<Left, Right, std::weak_ordering>) {
+        return left <=> right;
+      } else {
+        if (left < right) {
+          return std::weak_ordering::less;
+        }
+        return (right < left) ? std::weak_ordering::greater : std::weak_ordering::equivalent;
+      }
+    }
+  };
+
+  // Comparators accepted by the ordered containers: compare(a, b) behaves like a <=> b
+
+  template <typename Compare, typename Data>
+  concept ThreeWayComparator = std::invocable<const Compare&, const Data&, const Data&> &&
+                               requires(const Compare& compare, const Data& left, const Data& right) {
+                                 { compare(left, right) < 0 } -> std::convertible_to<bool>;
+                                 { compare(left, right) == 0 } -> std::convertible_to<bool>;
+                               };
+
+  /* ************************************************************************** */
+
+  // Heterogeneous keys: any type other than Data that is ordered against it (e.g. std::string_view
+  // for std::string), so that lookups do not need to build a Data. Arithmetic keys for arithmetic
+  // Data are excluded: they keep converting to Data as before (Exists(2.5) on ints looks for 2)
+
+  template <typename Key, typename Data>
+  concept ConvertedArithmeticKey = std::is_arithmetic_v<std::remove_cvref_t<Key>> && std::is_arithmetic_v<Data>;
+
+  template <typename Key, typename Data>
+  concept HeterogeneousKey = !std::same_as<std::remove_cvref_t<Key>, Data> && !ConvertedArithmeticKey<Key, Data> &&
+                             requires(const Data& data, const Key& key) {
+                               { data == key } -> std::convertible_to<bool>;
+                               { data < key } -> std::convertible_to<bool>;
+                               { key < data } -> std::convertible_to<bool>;
+                             };
+
+  /* ************************************************************************** */
+
   template <typename Data>
   class TestableContainer : virtual public Container {
 
@@ -40,6 +92,19 @@ namespace lasd {
 
     virtual bool Exists(const Data&) const noexcept = 0;
 
+    template <typename Key> requires HeterogeneousKey<Key, Data>
+    bool Exists(const Key&) const; // Lookup without building a Data (std::logic_error if the container cannot honour the key ordering)
+
+  protected:
+
+    // Position of an element with respect to the searched key (less: the element comes before the key)
+    using KeyProbe = std::function<std::weak_ordering(const Data&)>;
+
+    template <typename Key>
+    static KeyProbe MakeKeyProbe(const Key&) noexcept; // Captures the key by reference: no allocation
+
+    virtual bool ExistsKey(const KeyProbe&) const = 0;
+
   };
 
   /* ************************************************************************** */
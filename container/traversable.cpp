@@ -14,20 +14,88 @@ Accumulator TraversableContainer<Data>::Fold(FoldFun<Accumulator> fun, const Acc
   return result;
 }
 
+// Generic callables are forwarded by reference to the virtual entry points
+template <typename Data>
+template <TraverseCallable<Data> Fun>
+void TraversableContainer<Data>::Traverse(Fun&& fun) const {
+  Traverse(TraverseFun(std::ref(fun)));
+}
+
+template <typename Data>
+template <typename Accumulator, typename Fun> requires FoldCallable<Fun, Data, Accumulator>
+Accumulator TraversableContainer<Data>::Fold(Fun&& fun, const Accumulator& acc) const {
+  Accumulator result = acc;
+  Traverse(TraverseFun([&result, &fun](const Data& data) {
+    result = fun(data, result);
+  }));
+  return result;
+}
+
 /* ************************************************************************** */
 
-// Specific member function (inherited from TestableContainer)
+// Template FoldWhile function
 template <typename Data>
-bool TraversableContainer<Data>::Exists(const Data& data) const noexcept {
-  bool found = false;
+template <typename Accumulator>
+Accumulator TraversableContainer<Data>::FoldWhile(FoldWhileFun<Accumulator> fun, const Accumulator& acc) const {
+  Accumulator result = acc;
+  TraverseWhile([&result, &fun](const Data& data) {
+    return fun(data, result);
+  });
+  return result;
+}
+
+// Template FoldMove function
+template <typename Data>
+template <typename Accumulator, typename Fun> requires FoldMoveCallable<Fun, Data, Accumulator>
+Accumulator TraversableContainer<Data>::FoldMove(Fun&& fun, Accumulator acc) const {
+  Traverse(TraverseFun([&acc, &fun](const Data& data) {
+    acc = fun(data, std::move(acc));
+  }));
+  return acc;
+}
+
+/* ************************************************************************** */
 
-  Traverse([&found, &data](const Data& current) {
-    if (!found && current == data) {
-      found = true;
+template <typename Data>
+void TraversableContainer<Data>::TraverseChunks(ChunkFun fun) const {
+  if constexpr (std::is_copy_constructible_v<Data>) {
+    // Il buffer viene riutilizzato: la capacita' e' riservata una sola volta
+    std::vector<Data> buffer;
+    buffer.reserve(ChunkSize);
+
+    Traverse([&buffer, &fun](const Data& data) {
+      buffer.push_back(data);
+      if (buffer.size() == ChunkSize) {
+        fun(std::span<const Data>(buffer));
+        buffer.clear();
+      }
+    });
+
+    if (!buffer.empty()) {
+      fun(std::span<const Data>(buffer));
     }
+  } else {
+    // Senza copie ogni elemento e' un blocco a se'
+    Traverse([&fun](const Data& data) {
+      fun(std::span<const Data>(&data, 1));
+    });
+  }
+}
+
+// Specific member function (inherited from TestableContainer)
+template <typename Data>
+bool TraversableContainer<Data>::Exists(const Data& data) const noexcept {
+  // La visita si interrompe al primo elemento uguale
+  return !TraverseWhile([&data](const Data& current) {
+    return !(current == data);
   });
+}
 
-  return found;
+template <typename Data>
+bool TraversableContainer<Data>::ExistsKey(const KeyProbe& probe) const {
+  return !TraverseWhile([&probe](const Data& current) {
+    return (probe(current) != 0);
+  });
 }
 
 /* ************************************************************************** */
@@ -44,6 +112,47 @@ Accumulator PreOrderTraversableContainer<Data>::PreOrderFold(FoldFun<Accumulator
   return result;
 }
 
+template <typename Data>
+template <TraverseCallable<Data> Fun>
+void PreOrderTraversableContainer<Data>::PreOrderTraverse(Fun&& fun) const {
+  PreOrderTraverse(TraverseFun(std::ref(fun)));
+}
+
+template <typename Data>
+template <typename Accumulator, typename Fun> requires FoldCallable<Fun, Data, Accumulator>
+Accumulator PreOrderTraversableContainer<Data>::PreOrderFold(Fun&& fun, const Accumulator& acc) const {
+  Accumulator result = acc;
+  PreOrderTraverse(TraverseFun([&result, &fun](const Data& data) {
+    result = fun(data, result);
+  }));
+  return result;
+}
+
+/* ************************************************************************** */
+
+// Template PreOrderFoldMove function
+template <typename Data>
+template <typename Accumulator, typename Fun> requires FoldMoveCallable<Fun, Data, Accumulator>
+Accumulator PreOrderTraversableContainer<Data>::PreOrderFoldMove(Fun&& fun, Accumulator acc) const {
+  PreOrderTraverse(TraverseFun([&acc, &fun](const Data& data) {
+    acc = fun(data, std::move(acc));
+  }));
+  return acc;
+}
+
+/* ************************************************************************** */
+
+// Template PreOrderFoldWhile function
+template <typename Data>
+template <typename Accumulator>
+Accumulator PreOrderTraversableContainer<Data>::PreOrderFoldWhile(FoldWhileFun<Accumulator> fun, const Accumulator& acc) const {
+  Accumulator result = acc;
+  PreOrderTraverseWhile([&result, &fun](const Data& data) {
+    return fun(data, result);
+  });
+  return result;
+}
+
 /* ************************************************************************** */
 
 // Specific member function (inherited from TraversableContainer)
@@ -52,6 +161,17 @@ void PreOrderTraversableContainer<Data>::Traverse(TraverseFun fun) const {
   PreOrderTraverse(fun);
 }
 
+template <typename Data>
+bool PreOrderTraversableContainer<Data>::TraverseWhile(TraverseWhileFun fun) const {
+  return PreOrderTraverseWhile(fun);
+}
+
+template <typename Data>
+template <TraverseCallable<Data> Fun>
+void PreOrderTraversableContainer<Data>::Traverse(Fun&& fun) const {
+  PreOrderTraverse(std::forward<Fun>(fun));
+}
+
 /* ************************************************************************** */
 
 // Template Fold function
@@ -61,6 +181,24 @@ Accumulator PreOrderTraversableContainer<Data>::Fold(FoldFun<Accumulator> fun, c
   return PreOrderFold(fun, acc);
 }
 
+template <typename Data>
+template <typename Accumulator, typename Fun> requires FoldCallable<Fun, Data, Accumulator>
+Accumulator PreOrderTraversableContainer<Data>::Fold(Fun&& fun, const Accumulator& acc) const {
+  return PreOrderFold<Accumulator>(std::forward<Fun>(fun), acc);
+}
+
+template <typename Data>
+template <typename Accumulator>
+Accumulator PreOrderTraversableContainer<Data>::FoldWhile(FoldWhileFun<Accumulator> fun, const Accumulator& acc) const {
+  return PreOrderFoldWhile(fun, acc);
+}
+
+template <typename Data>
+template <typename Accumulator, typename Fun> requires FoldMoveCallable<Fun, Data, Accumulator>
+Accumulator PreOrderTraversableContainer<Data>::FoldMove(Fun&& fun, Accumulator acc) const {
+  return PreOrderFoldMove<Accumulator>(std::forward<Fun>(fun), std::move(acc));
+}
+
 /* ************************************************************************** */
 
 // Template PostOrderFold function
@@ -75,6 +213,47 @@ Accumulator PostOrderTraversableContainer<Data>::PostOrderFold(FoldFun<Accumulat
   return result;
 }
 
+template <typename Data>
+template <TraverseCallable<Data> Fun>
+void PostOrderTraversableContainer<Data>::PostOrderTraverse(Fun&& fun) const {
+  PostOrderTraverse(TraverseFun(std::ref(fun)));
+}
+
+template <typename Data>
+template <typename Accumulator, typename Fun> requires FoldCallable<Fun, Data, Accumulator>
+Accumulator PostOrderTraversableContainer<Data>::PostOrderFold(Fun&& fun, const Accumulator& acc) const {
+  Accumulator result = acc;
+  PostOrderTraverse(TraverseFun([&result, &fun](const Data& data) {
+    result = fun(data, result);
+  }));
+  return result;
+}
+
+/* ************************************************************************** */
+
+// Template PostOrderFoldMove function
+template <typename Data>
+template <typename Accumulator, typename Fun> requires FoldMoveCallable<Fun, Data, Accumulator>
+Accumulator PostOrderTraversableContainer<Data>::PostOrderFoldMove(Fun&& fun, Accumulator acc) const {
+  PostOrderTraverse(TraverseFun([&acc, &fun](const Data& data) {
+    acc = fun(data, std::move(acc));
+  }));
+  return acc;
+}
+
+/* ************************************************************************** */
+
+// Template PostOrderFoldWhile function
+template <typename Data>
+template <typename Accumulator>
+Accumulator PostOrderTraversableContainer<Data>::PostOrderFoldWhile(FoldWhileFun<Accumulator> fun, const Accumulator& acc) const {
+  Accumulator result = acc;
+  PostOrderTraverseWhile([&result, &fun](const Data& data) {
+    return fun(data, result);
+  });
+  return result;
+}
+
 /* ************************************************************************** */
 
 // Specific member function (inherited from TraversableContainer)
@@ -83,6 +262,17 @@ void PostOrderTraversableContainer<Data>::Traverse(TraverseFun fun) const {
   PostOrderTraverse(fun);
 }
 
+template <typename Data>
+bool PostOrderTraversableContainer<Data>::TraverseWhile(TraverseWhileFun fun) const {
+  return PostOrderTraverseWhile(fun);
+}
+
+template <typename Data>
+template <TraverseCallable<Data> Fun>
+void PostOrderTraversableContainer<Data>::Traverse(Fun&& fun) const {
+  PostOrderTraverse(std::forward<Fun>(fun));
+}
+
 /* ************************************************************************** */
 
 // Template Fold function
@@ -92,6 +282,24 @@ Accumulator PostOrderTraversableContainer<Data>::Fold(FoldFun<Accumulator> fun,
   return PostOrderFold(fun, acc);
 }
 
+template <typename Data>
+template <typename Accumulator, typename Fun> requires FoldCallable<Fun, Data, Accumulator>
+Accumulator PostOrderTraversableContainer<Data>::Fold(Fun&& fun, const Accumulator& acc) const {
+  return PostOrderFold<Accumulator>(std::forward<Fun>(fun), acc);
+}
+
+template <typename Data>
+template <typename Accumulator>
+Accumulator PostOrderTraversableContainer<Data>::FoldWhile(FoldWhileFun<Accumulator> fun, const Accumulator& acc) const {
+  return PostOrderFoldWhile(fun, acc);
+}
+
+template <typename Data>
+template <typename Accumulator, typename Fun> requires FoldMoveCallable<Fun, Data, Accumulator>
+Accumulator PostOrderTraversableContainer<Data>::FoldMove(Fun&& fun, Accumulator acc) const {
+  return PostOrderFoldMove<Accumulator>(std::forward<Fun>(fun), std::move(acc));
+}
+
 /* ************************************************************************** */
 
 }
\ No newline at end of file
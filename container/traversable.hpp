@@ -4,6 +4,10 @@
 /* ************************************************************************** */
 
 #include <functional>
+#include <concepts>
+#include <span>
+#include <vector>
+#include <type_traits>
 
 /* ************************************************************************** */
 
@@ -15,6 +19,22 @@ namespace lasd {
 
 /* ************************************************************************** */
 
+// Callables accepted by the templated overloads; std::function objects keep using the virtual entry points
+
+template <typename Fun, typename Data>
+concept TraverseCallable = std::invocable<Fun&, const Data&> &&
+                           !std::same_as<std::remove_cvref_t<Fun>, std::function<void(const Data&)>>;
+
+template <typename Fun, typename Data, typename Accumulator>
+concept FoldCallable = std::is_invocable_r_v<Accumulator, Fun&, const Data&, const Accumulator&> &&
+                       !std::same_as<std::remove_cvref_t<Fun>, std::function<Accumulator(const Data&, const Accumulator&)>>;
+
+// Move-aware fold step: receives the accumulator as an rvalue and returns it (typically after updating it in place)
+template <typename Fun, typename Data, typename Accumulator>
+concept FoldMoveCallable = std::is_invocable_r_v<Accumulator, Fun&, const Data&, Accumulator&&>;
+
+/* ************************************************************************** */
+
 template <typename Data>
 class TraversableContainer : virtual public TestableContainer<Data> {
 
@@ -53,6 +73,15 @@ public:
 
   virtual void Traverse(TraverseFun) const = 0;
 
+  // Short-circuiting traversal: the function returns true to continue, false to stop
+  using TraverseWhileFun = std::function<bool(const Data&)>;
+
+  virtual bool TraverseWhile(TraverseWhileFun) const = 0; // True if the whole container was visited
+
+  // Generic callable (statically dispatched where the concrete type allows it)
+  template <TraverseCallable<Data> Fun>
+  void Traverse(Fun&& fun) const;
+
   /* ************************************************************************ */
 
   // Template Fold function
@@ -62,12 +91,48 @@ public:
   template <typename Accumulator>
   Accumulator Fold(FoldFun<Accumulator> fun, const Accumulator& acc) const;
 
+  template <typename Accumulator, typename Fun> requires FoldCallable<Fun, Data, Accumulator>
+  Accumulator Fold(Fun&& fun, const Accumulator& acc) const;
+
+  // Short-circuiting fold: the accumulator is updated in place, false stops the fold
+  template <typename Accumulator>
+  using FoldWhileFun = std::function<bool(const Data&, Accumulator&)>;
+
+  template <typename Accumulator>
+  Accumulator FoldWhile(FoldWhileFun<Accumulator> fun, const Accumulator& acc) const;
+
+  // Move-aware fold: the accumulator is moved through every step instead of being copied
+  template <typename Accumulator>
+  using FoldMoveFun = std::function<Accumulator(const Data&, Accumulator&&)>;
+
+  template <typename Accumulator, typename Fun> requires FoldMoveCallable<Fun, Data, Accumulator>
+  Accumulator FoldMove(Fun&& fun, Accumulator acc) const;
+
+  /* ************************************************************************ */
+
+  // Block traversal: contiguous containers hand out their whole storage as a single span,
+  // the others gather copies into a staging buffer of at most ChunkSize elements (one element
+  // per chunk when Data is not copyable)
+  using ChunkFun = std::function<void(std::span<const Data>)>;
+
+  static constexpr ulong ChunkSize = 64;
+
+  virtual void TraverseChunks(ChunkFun) const;
+
   /* ************************************************************************ */
 
   // Specific member function (inherited from TestableContainer)
 
   virtual bool Exists(const Data&) const noexcept override; // Override TestableContainer member
 
+  using TestableContainer<Data>::Exists;
+
+protected:
+
+  using typename TestableContainer<Data>::KeyProbe;
+
+  bool ExistsKey(const KeyProbe&) const override; // Linear scan
+
 };
 
 /* ************************************************************************** */
@@ -110,6 +175,13 @@ public:
 
   virtual void PreOrderTraverse(TraverseFun) const = 0;
 
+  using typename TraversableContainer<Data>::TraverseWhileFun;
+
+  virtual bool PreOrderTraverseWhile(TraverseWhileFun) const = 0;
+
+  template <TraverseCallable<Data> Fun>
+  void PreOrderTraverse(Fun&& fun) const;
+
   /* ************************************************************************ */
 
   // Template PreOrderFold function
@@ -119,18 +191,44 @@ public:
   template <typename Accumulator>
   Accumulator PreOrderFold(FoldFun<Accumulator> fun, const Accumulator& acc) const;
 
+  template <typename Accumulator, typename Fun> requires FoldCallable<Fun, Data, Accumulator>
+  Accumulator PreOrderFold(Fun&& fun, const Accumulator& acc) const;
+
+  template <typename Accumulator>
+  using FoldWhileFun = typename TraversableContainer<Data>::template FoldWhileFun<Accumulator>;
+
+  template <typename Accumulator>
+  Accumulator PreOrderFoldWhile(FoldWhileFun<Accumulator> fun, const Accumulator& acc) const;
+
+  template <typename Accumulator, typename Fun> requires FoldMoveCallable<Fun, Data, Accumulator>
+  Accumulator PreOrderFoldMove(Fun&& fun, Accumulator acc) const;
+
   /* ************************************************************************ */
 
   // Specific member function (inherited from TraversableContainer)
 
   virtual void Traverse(TraverseFun) const override; // Override TraversableContainer member
 
+  virtual bool TraverseWhile(TraverseWhileFun) const override; // Override TraversableContainer member
+
+  template <TraverseCallable<Data> Fun>
+  void Traverse(Fun&& fun) const;
+
   /* ************************************************************************ */
 
   // Template Fold function
   template <typename Accumulator>
   Accumulator Fold(FoldFun<Accumulator> fun, const Accumulator& acc) const;
 
+  template <typename Accumulator, typename Fun> requires FoldCallable<Fun, Data, Accumulator>
+  Accumulator Fold(Fun&& fun, const Accumulator& acc) const;
+
+  template <typename Accumulator>
+  Accumulator FoldWhile(FoldWhileFun<Accumulator> fun, const Accumulator& acc) const;
+
+  template <typename Accumulator, typename Fun> requires FoldMoveCallable<Fun, Data, Accumulator>
+  Accumulator FoldMove(Fun&& fun, Accumulator acc) const;
+
 };
 
 /* ************************************************************************** */
@@ -173,6 +271,13 @@ public:
 
   virtual void PostOrderTraverse(TraverseFun) const = 0;
 
+  using typename TraversableContainer<Data>::TraverseWhileFun;
+
+  virtual bool PostOrderTraverseWhile(TraverseWhileFun) const = 0;
+
+  template <TraverseCallable<Data> Fun>
+  void PostOrderTraverse(Fun&& fun) const;
+
   /* ************************************************************************ */
 
   // Template PostOrderFold function
@@ -182,18 +287,44 @@ public:
   template <typename Accumulator>
   Accumulator PostOrderFold(FoldFun<Accumulator> fun, const Accumulator& acc) const;
 
+  template <typename Accumulator, typename Fun> requires FoldCallable<Fun, Data, Accumulator>
+  Accumulator PostOrderFold(Fun&& fun, const Accumulator& acc) const;
+
+  template <typename Accumulator>
+  using FoldWhileFun = typename TraversableContainer<Data>::template FoldWhileFun<Accumulator>;
+
+  template <typename Accumulator>
+  Accumulator PostOrderFoldWhile(FoldWhileFun<Accumulator> fun, const Accumulator& acc) const;
+
+  template <typename Accumulator, typename Fun> requires FoldMoveCallable<Fun, Data, Accumulator>
+  Accumulator PostOrderFoldMove(Fun&& fun, Accumulator acc) const;
+
   /* ************************************************************************ */
 
   // Specific member function (inherited from TraversableContainer)
 
   virtual void Traverse(TraverseFun) const override; // Override TraversableContainer member
 
+  virtual bool TraverseWhile(TraverseWhileFun) const override; // Override TraversableContainer member
+
+  template <TraverseCallable<Data> Fun>
+  void Traverse(Fun&& fun) const;
+
   /* ************************************************************************ */
 
   // Template Fold function - override semantico, non virtuale
   template <typename Accumulator>
   Accumulator Fold(FoldFun<Accumulator> fun, const Accumulator& acc) const;
 
+  template <typename Accumulator, typename Fun> requires FoldCallable<Fun, Data, Accumulator>
+  Accumulator Fold(Fun&& fun, const Accumulator& acc) const;
+
+  template <typename Accumulator>
+  Accumulator FoldWhile(FoldWhileFun<Accumulator> fun, const Accumulator& acc) const;
+
+  template <typename Accumulator, typename Fun> requires FoldMoveCallable<Fun, Data, Accumulator>
+  Accumulator FoldMove(Fun&& fun, Accumulator acc) const;
+
 };
 
 /* ************************************************************************** */
@@ -4,9 +4,26 @@
 namespace lasd {
     /* ************************************************************************** */
 
+    // Specific constructor with a memory resource
+    template<typename Data>
+    List<Data>::List(std::pmr::memory_resource &memoryResource) noexcept : resource(&memoryResource) {
+    }
+
+    template<typename Data>
+    List<Data>::List(ArenaMode) : List(NewArena()) {
+    }
+
+    template<typename Data>
+    List<Data>::List(std::pmr::monotonic_buffer_resource *ownedArena) noexcept : arena(ownedArena) {
+        if (arena != nullptr) {
+            resource = arena;
+        }
+    }
+
     // Specific constructor from TraversableContainer
     template<typename Data>
-    List<Data>::List(const TraversableContainer<Data> &container) {
+    List<Data>::List(const TraversableContainer<Data> &container, std::pmr::memory_resource &memoryResource)
+        : resource(&memoryResource) {
         container.Traverse([this](const Data &data) {
             InsertAtBack(data);
         });
@@ -14,7 +31,8 @@ namespace lasd {
 
     // Specific constructor from MappableContainer
     template<typename Data>
-    List<Data>::List(MappableContainer<Data> &&container) {
+    List<Data>::List(MappableContainer<Data> &&container, std::pmr::memory_resource &memoryResource)
+        : resource(&memoryResource) {
         container.Map([this](Data &data) {
             InsertAtBack(std::move(data));
         });
@@ -22,13 +40,16 @@ namespace lasd {
 
     // Copy constructor
     template<typename Data>
-    List<Data>::List(const List<Data> &other) {
-        if (!other.Empty()) {
-            Node *current = other.head;
-            while (current != nullptr) {
-                InsertAtBack(current->data);
-                current = current->next;
-            }
+    List<Data>::List(const List<Data> &other) : List((other.arena != nullptr) ? NewArena() : nullptr) {
+        for (Node *current = other.head; current != nullptr; current = current->next) {
+            InsertAtBack(current->data);
+        }
+    }
+
+    template<typename Data>
+    List<Data>::List(const List<Data> &other, std::pmr::memory_resource &memoryResource) : resource(&memoryResource) {
+        for (Node *current = other.head; current != nullptr; current = current->next) {
+            InsertAtBack(current->data);
         }
     }
 
@@ -36,6 +57,7 @@ namespace lasd {
     template<typename Data>
     List<Data>::~List() {
         Clear();
+        delete arena;
     }
 
     // Copy assignment
@@ -56,24 +78,59 @@ namespace lasd {
 
     // Move constructor
     template<typename Data>
-    List<Data>::List(List&& other) noexcept {
+    List<Data>::List(List&& other) noexcept : resource(other.resource), arena(other.arena), slab(other.slab) {
         head = other.head;
         tail = other.tail;
         size = other.size;
         other.head = nullptr;
         other.tail = nullptr;
         other.size = 0;
+        other.slab = nullptr;
+        other.InvalidateHash();
+
+        if (arena != nullptr) { // L'arena segue i nodi, la sorgente torna alla risorsa di default
+            other.arena = nullptr;
+            other.resource = &NodePool::Default();
+        }
     }
 
     // Move assignmentst
     template <typename Data>
-    List<Data> &List<Data>::operator=(List &&other) noexcept
+    List<Data> &List<Data>::operator=(List &&other)
     {
         if (this != &other)
         {
-            std::swap(head, other.head);
-            std::swap(tail, other.tail);
-            std::swap(size, other.size);
+            if (arena != nullptr && other.arena != nullptr)
+            {
+                // Entrambe in modalità arena: si scambiano nodi e regioni
+                std::swap(head, other.head);
+                std::swap(tail, other.tail);
+                std::swap(size, other.size);
+                std::swap(slab, other.slab);
+                std::swap(arena, other.arena);
+                std::swap(resource, other.resource);
+                this->InvalidateHash();
+                other.InvalidateHash();
+            }
+            else if (*resource == *other.resource)
+            {
+                std::swap(head, other.head);
+                std::swap(tail, other.tail);
+                std::swap(size, other.size);
+                std::swap(slab, other.slab);
+                this->InvalidateHash();
+                other.InvalidateHash();
+            }
+            else
+            {
+                // Risorse diverse: i dati si spostano in nodi di questa lista (come per std::pmr)
+                Clear();
+                for (Node *current = other.head; current != nullptr; current = current->next)
+                {
+                    InsertAtBack(std::move(current->data));
+                }
+                other.Clear();
+            }
         }
         return *this;
     }
@@ -108,7 +165,7 @@ namespace lasd {
     // Specific member functions
     template<typename Data>
     void List<Data>::InsertAtFront(const Data &value) {
-        Node *newNode = new Node(value);
+        Node *newNode = NewNode(value);
 
         if (head == nullptr) {
             head = tail = newNode;
@@ -118,11 +175,12 @@ namespace lasd {
         }
 
         size++;
+        this->HashInserted(newNode->data);
     }
 
     template<typename Data>
     void List<Data>::InsertAtFront(Data &&value) noexcept {
-        Node *newNode = new Node(std::move(value));
+        Node *newNode = NewNode(std::move(value));
 
         if (head == nullptr) {
             head = tail = newNode;
@@ -132,38 +190,49 @@ namespace lasd {
         }
 
         size++;
+        this->HashInserted(newNode->data);
     }
 
     template<typename Data>
-    void List<Data>::RemoveFromFront() {
-        if (Empty()) {
-            throw std::length_error("Empty list");
+    template<typename... Args>
+    Data &List<Data>::EmplaceAtFront(Args &&... args) {
+        Node *newNode = NewNode(std::in_place, std::forward<Args>(args)...);
+
+        if (head == nullptr) {
+            head = tail = newNode;
+        } else {
+            newNode->next = head;
+            head = newNode;
         }
 
-        Node *temp = head;
+        size++;
+        this->HashInserted(newNode->data);
+        return newNode->data;
+    }
 
-        if (head == tail) {
-            head = tail = nullptr;
-        } else {
-            head = head->next;
+    template<typename Data>
+    void List<Data>::RemoveFromFront() {
+        if (Empty()) {
+            throw std::length_error("Empty list");
         }
 
-        delete temp;
-        size--;
+        this->HashRemoved(head->data);
+        UnlinkFront();
     }
 
     template<typename Data>
     Data List<Data>::FrontNRemove() {
         if (size == 0)
             throw std::length_error("Length error!");
-        Data result = head->data;  // Crea una copia
-        RemoveFromFront();
-        return result;  // Restituisci per valore
+        Data result = std::move(head->data);  // Sposta il valore fuori dal nodo
+        UnlinkFront();
+        this->HashRemoved(result);
+        return result;
     }
 
     template<typename Data>
     void List<Data>::InsertAtBack(const Data &value) {
-        Node *newNode = new Node(value);
+        Node *newNode = NewNode(value);
 
         if (tail == nullptr) {
             head = tail = newNode;
@@ -173,11 +242,12 @@ namespace lasd {
         }
 
         size++;
+        this->HashAppended(newNode->data);
     }
 
     template<typename Data>
     void List<Data>::InsertAtBack(Data &&value) noexcept {
-        Node *newNode = new Node(std::move(value));
+        Node *newNode = NewNode(std::move(value));
 
         if (tail == nullptr) {
             head = tail = newNode;
@@ -187,6 +257,24 @@ namespace lasd {
         }
 
         size++;
+        this->HashAppended(newNode->data);
+    }
+
+    template<typename Data>
+    template<typename... Args>
+    Data &List<Data>::EmplaceAtBack(Args &&... args) {
+        Node *newNode = NewNode(std::in_place, std::forward<Args>(args)...);
+
+        if (tail == nullptr) {
+            head = tail = newNode;
+        } else {
+            tail->next = newNode;
+            tail = newNode;
+        }
+
+        size++;
+        this->HashAppended(newNode->data);
+        return newNode->data;
     }
 
     template<typename Data>
@@ -195,8 +283,10 @@ namespace lasd {
             throw std::length_error("Empty list");
         }
 
+        this->HashRemoved(tail->data);
+
         if (head == tail) {
-            delete head;
+            DeleteNode(head);
             head = tail = nullptr;
         } else {
             Node *current = head;
@@ -205,7 +295,7 @@ namespace lasd {
                 current = current->next;
             }
 
-            delete tail;
+            DeleteNode(tail);
             tail = current;
             tail->next = nullptr;
         }
@@ -219,11 +309,10 @@ namespace lasd {
             throw std::length_error("Empty list");
         }
 
-        Data value;
+        Node *last = tail;
+        Data value = std::move(last->data);  // Costruito direttamente per spostamento
 
         if (head == tail) {
-            value = std::move(head->data);
-            delete head;
             head = tail = nullptr;
         } else {
             Node *current = head;
@@ -232,17 +321,52 @@ namespace lasd {
                 current = current->next;
             }
 
-            value = std::move(tail->data);
-            delete tail;
             tail = current;
             tail->next = nullptr;
         }
 
+        DeleteNode(last);
         size--;
+        this->HashRemoved(value);
 
         return value;
     }
 
+    template<typename Data>
+    template<RemovePredicate<Data> Fun>
+    ulong List<Data>::RemoveIf(Fun &&fun) {
+        ulong removed = 0;
+        Node *previous = nullptr;
+        Node *current = head;
+
+        while (current != nullptr) {
+            Node *next = current->next;
+
+            if (fun(static_cast<const Data &>(current->data))) {
+                if (previous == nullptr) {
+                    head = next;
+                } else {
+                    previous->next = next;
+                }
+
+                if (current == tail) {
+                    tail = previous;
+                }
+
+                this->HashRemoved(current->data);
+                DeleteNode(current);
+                size--;
+                removed++;
+            } else {
+                previous = current;
+            }
+
+            current = next;
+        }
+
+        return removed;
+    }
+
     // Specific member functions (inherited from MutableLinearContainer)
     template<typename Data>
     Data &List<Data>::operator[](ulong index) {
@@ -250,6 +374,7 @@ namespace lasd {
             throw std::out_of_range("Index out of range");
         }
 
+        this->InvalidateHash(); // Il chiamante puo' modificare l'elemento
         return GetNodeAt(index)->data;
     }
 
@@ -259,6 +384,7 @@ namespace lasd {
             throw std::length_error("Empty list");
         }
 
+        this->InvalidateHash();
         return head->data;
     }
 
@@ -268,6 +394,7 @@ namespace lasd {
             throw std::length_error("Empty list");
         }
 
+        this->InvalidateHash();
         return tail->data;
     }
 
@@ -283,19 +410,70 @@ namespace lasd {
 
     template<typename Data>
     const Data &List<Data>::Front() const {
-        if (Empty()) {
-            throw std::length_error("Empty list");
+        if (const Data *front = TryFront()) {
+            return *front;
         }
 
-        return head->data;
+        throw std::length_error("Empty list");
     }
 
     template<typename Data>
     const Data &List<Data>::Back() const {
-        if (Empty()) {
-            throw std::length_error("Empty list");
+        if (const Data *back = TryBack()) {
+            return *back;
         }
 
+        throw std::length_error("Empty list");
+    }
+
+    template<typename Data>
+    const Data *List<Data>::TryFront() const noexcept {
+        return (head == nullptr) ? nullptr : &head->data;
+    }
+
+    template<typename Data>
+    const Data *List<Data>::TryBack() const noexcept {
+        return (tail == nullptr) ? nullptr : &tail->data;
+    }
+
+    // Unchecked access
+
+    template<typename Data>
+    inline Data &List<Data>::UncheckedAt(ulong index) noexcept {
+        assert(index < size && "List::UncheckedAt out of range");
+        this->InvalidateHash();
+        return GetNodeAt(index)->data;
+    }
+
+    template<typename Data>
+    inline const Data &List<Data>::UncheckedAt(ulong index) const noexcept {
+        assert(index < size && "List::UncheckedAt out of range");
+        return GetNodeAt(index)->data;
+    }
+
+    template<typename Data>
+    inline Data &List<Data>::UncheckedFront() noexcept {
+        assert(head != nullptr && "List::UncheckedFront on an empty list");
+        this->InvalidateHash();
+        return head->data;
+    }
+
+    template<typename Data>
+    inline const Data &List<Data>::UncheckedFront() const noexcept {
+        assert(head != nullptr && "List::UncheckedFront on an empty list");
+        return head->data;
+    }
+
+    template<typename Data>
+    inline Data &List<Data>::UncheckedBack() noexcept {
+        assert(tail != nullptr && "List::UncheckedBack on an empty list");
+        this->InvalidateHash();
+        return tail->data;
+    }
+
+    template<typename Data>
+    inline const Data &List<Data>::UncheckedBack() const noexcept {
+        assert(tail != nullptr && "List::UncheckedBack on an empty list");
         return tail->data;
     }
 
@@ -308,6 +486,7 @@ namespace lasd {
     // Specific member function (inherited from PreOrderMappableContainer)
     template<typename Data>
     void List<Data>::PreOrderMap(MapFun fun) {
+        this->InvalidateHash();
         Node *current = head;
 
         while (current != nullptr) {
@@ -319,6 +498,7 @@ namespace lasd {
     // Specific member function (inherited from PostOrderMappableContainer)
     template<typename Data>
     void List<Data>::PostOrderMap(MapFun fun) {
+        this->InvalidateHash();
 
         if (!Empty()) {
             std::stack<Node *> stack;
@@ -342,6 +522,37 @@ namespace lasd {
         PreOrderTraverse(fun);
     }
 
+    template<typename Data>
+    bool List<Data>::TraverseWhile(TraverseWhileFun fun) const {
+        return PreOrderTraverseWhile(fun);
+    }
+
+    template<typename Data>
+    void List<Data>::TraverseChunks(ChunkFun fun) const {
+        if constexpr (std::is_copy_constructible_v<Data>) {
+            const ulong chunkSize = TraversableContainer<Data>::ChunkSize;
+            std::vector<Data> buffer;
+            buffer.reserve(size < chunkSize ? size : chunkSize);
+
+            for (const Node *current = head; current != nullptr; current = current->next) {
+                buffer.push_back(current->data);
+                if (buffer.size() == chunkSize) {
+                    fun(std::span<const Data>(buffer));
+                    buffer.clear();
+                }
+            }
+
+            if (!buffer.empty()) {
+                fun(std::span<const Data>(buffer));
+            }
+        } else {
+            // Senza copie ogni nodo e' un blocco a se'
+            for (const Node *current = head; current != nullptr; current = current->next) {
+                fun(std::span<const Data>(&current->data, 1));
+            }
+        }
+    }
+
     // Specific member function (inherited from PreOrderTraversableContainer)
     template<typename Data>
     void List<Data>::PreOrderTraverse(TraverseFun fun) const {
@@ -353,6 +564,20 @@ namespace lasd {
         }
     }
 
+    template<typename Data>
+    bool List<Data>::PreOrderTraverseWhile(TraverseWhileFun fun) const {
+        Node *current = head;
+
+        while (current != nullptr) {
+            if (!fun(current->data)) {
+                return false;
+            }
+            current = current->next;
+        }
+
+        return true;
+    }
+
     // Specific member function (inherited from PostOrderTraversableContainer)
     template<typename Data>
     void List<Data>::PostOrderTraverse(TraverseFun fun) const {
@@ -372,15 +597,286 @@ namespace lasd {
         }
     }
 
+    template<typename Data>
+    bool List<Data>::PostOrderTraverseWhile(TraverseWhileFun fun) const {
+        if (!Empty()) {
+            std::stack<Node *> stack;
+            Node *current = head;
+
+            while (current != nullptr) {
+                stack.push(current);
+                current = current->next;
+            }
+
+            while (!stack.empty()) {
+                if (!fun(stack.top()->data)) {
+                    return false;
+                }
+                stack.pop();
+            }
+        }
+
+        return true;
+    }
+
+    // Statically dispatched overloads for generic callables
+    template<typename Data>
+    template<TraverseCallable<Data> Fun>
+    void List<Data>::Traverse(Fun &&fun) const {
+        PreOrderTraverse(std::forward<Fun>(fun));
+    }
+
+    template<typename Data>
+    template<TraverseCallable<Data> Fun>
+    void List<Data>::PreOrderTraverse(Fun &&fun) const {
+        for (const Node *current = head; current != nullptr; current = current->next) {
+            fun(current->data);
+        }
+    }
+
+    template<typename Data>
+    template<TraverseCallable<Data> Fun>
+    void List<Data>::PostOrderTraverse(Fun &&fun) const {
+        if (!Empty()) {
+            std::stack<const Node *> stack;
+
+            for (const Node *current = head; current != nullptr; current = current->next) {
+                stack.push(current);
+            }
+
+            while (!stack.empty()) {
+                fun(stack.top()->data);
+                stack.pop();
+            }
+        }
+    }
+
+    template<typename Data>
+    template<typename Accumulator, typename Fun> requires FoldCallable<Fun, Data, Accumulator>
+    Accumulator List<Data>::Fold(Fun &&fun, const Accumulator &acc) const {
+        return PreOrderFold<Accumulator>(std::forward<Fun>(fun), acc);
+    }
+
+    template<typename Data>
+    template<typename Accumulator, typename Fun> requires FoldCallable<Fun, Data, Accumulator>
+    Accumulator List<Data>::PreOrderFold(Fun &&fun, const Accumulator &acc) const {
+        Accumulator accumulator = acc;
+
+        for (const Node *current = head; current != nullptr; current = current->next) {
+            accumulator = fun(current->data, accumulator);
+        }
+
+        return accumulator;
+    }
+
+    template<typename Data>
+    template<typename Accumulator, typename Fun> requires FoldCallable<Fun, Data, Accumulator>
+    Accumulator List<Data>::PostOrderFold(Fun &&fun, const Accumulator &acc) const {
+        Accumulator accumulator = acc;
+
+        PostOrderTraverse([&accumulator, &fun](const Data &data) {
+            accumulator = fun(data, accumulator);
+        });
+
+        return accumulator;
+    }
+
+    template<typename Data>
+    template<typename Accumulator, typename Fun> requires FoldMoveCallable<Fun, Data, Accumulator>
+    Accumulator List<Data>::FoldMove(Fun &&fun, Accumulator acc) const {
+        return PreOrderFoldMove<Accumulator>(std::forward<Fun>(fun), std::move(acc));
+    }
+
+    template<typename Data>
+    template<typename Accumulator, typename Fun> requires FoldMoveCallable<Fun, Data, Accumulator>
+    Accumulator List<Data>::PreOrderFoldMove(Fun &&fun, Accumulator acc) const {
+        for (const Node *current = head; current != nullptr; current = current->next) {
+            acc = fun(current->data, std::move(acc));
+        }
+
+        return acc;
+    }
+
+    template<typename Data>
+    template<typename Accumulator, typename Fun> requires FoldMoveCallable<Fun, Data, Accumulator>
+    Accumulator List<Data>::PostOrderFoldMove(Fun &&fun, Accumulator acc) const {
+        PostOrderTraverse([&acc, &fun](const Data &data) {
+            acc = fun(data, std::move(acc));
+        });
+
+        return acc;
+    }
+
+    template<typename Data>
+    template<MapCallable<Data> Fun>
+    void List<Data>::Map(Fun &&fun) {
+        PreOrderMap(std::forward<Fun>(fun));
+    }
+
+    template<typename Data>
+    template<MapCallable<Data> Fun>
+    void List<Data>::PreOrderMap(Fun &&fun) {
+        this->InvalidateHash();
+        for (Node *current = head; current != nullptr; current = current->next) {
+            fun(current->data);
+        }
+    }
+
+    template<typename Data>
+    template<MapCallable<Data> Fun>
+    void List<Data>::PostOrderMap(Fun &&fun) {
+        this->InvalidateHash();
+        if (!Empty()) {
+            std::stack<Node *> stack;
+
+            for (Node *current = head; current != nullptr; current = current->next) {
+                stack.push(current);
+            }
+
+            while (!stack.empty()) {
+                fun(stack.top()->data);
+                stack.pop();
+            }
+        }
+    }
+
+    template<typename Data>
+    void List<Data>::Compact() {
+        if (size == 0) {
+            return;
+        }
+
+        // I dati vengono spostati (o copiati, se lo spostamento può lanciare) in un unico blocco: in caso
+        // di eccezione la lista resta com'era
+        SlabHeader *compacted = static_cast<SlabHeader *>(resource->allocate(SlabOffset + size * sizeof(Node), SlabAlignment));
+        compacted->capacity = size;
+        compacted->live = size;
+        Node *nodes = SlabNodes(compacted);
+
+        unsigned long built = 0;
+        if constexpr (std::is_nothrow_move_constructible_v<Data>) {
+            // Nessuna eccezione possibile: un solo passaggio sui nodi sparsi, che tornano subito alla risorsa
+            Node *current = head;
+            while (current != nullptr) {
+                Node *next = current->next;
+                ::new(static_cast<void *>(nodes + built++)) Node(std::move(current->data));
+                DeleteNode(current);
+                current = next;
+            }
+        } else {
+            try {
+                for (Node *current = head; current != nullptr; current = current->next, built++) {
+                    ::new(static_cast<void *>(nodes + built)) Node(std::move_if_noexcept(current->data));
+                }
+            } catch (...) {
+                while (built > 0) {
+                    nodes[--built].~Node();
+                }
+                resource->deallocate(compacted, SlabOffset + size * sizeof(Node), SlabAlignment);
+                throw;
+            }
+
+            // I vecchi nodi (compreso un eventuale blocco precedente) tornano alla risorsa
+            Node *current = head;
+            while (current != nullptr) {
+                Node *next = current->next;
+                DeleteNode(current);
+                current = next;
+            }
+        }
+
+        for (unsigned long index = 0; index + 1 < size; index++) {
+            nodes[index].next = &nodes[index + 1];
+        }
+
+        head = nodes;
+        tail = &nodes[size - 1];
+        slab = compacted;
+    }
+
     // Specific member function (inherited from ClearableContainer)
     template<typename Data>
     void List<Data>::Clear() {
-        while (!Empty()) {
-            RemoveFromFront();
+        if (arena != nullptr) {
+            // Con Data banalmente distruttibile la regione si libera senza visitare i nodi
+            if constexpr (!std::is_trivially_destructible_v<Data>) {
+                while (head != nullptr) {
+                    Node *next = head->next;
+                    head->~Node();
+                    head = next;
+                }
+            }
+            head = tail = nullptr;
+            size = 0;
+            slab = nullptr; // Anche il blocco compattato veniva dall'arena
+            arena->release();
+        } else {
+            while (head != nullptr) {
+                UnlinkFront();
+            }
         }
+        this->InvalidateHash();
     }
 
     // Auxiliary functions
+    template<typename Data>
+    template<typename... Args>
+    typename List<Data>::Node *List<Data>::NewNode(Args &&... args) {
+        void *memory = resource->allocate(sizeof(Node), alignof(Node));
+        try {
+            return ::new(memory) Node(std::forward<Args>(args)...);
+        } catch (...) {
+            resource->deallocate(memory, sizeof(Node), alignof(Node));
+            throw;
+        }
+    }
+
+    template<typename Data>
+    std::pmr::monotonic_buffer_resource *List<Data>::NewArena() {
+        return new std::pmr::monotonic_buffer_resource(std::pmr::get_default_resource());
+    }
+
+    template<typename Data>
+    void List<Data>::DeleteNode(Node *node) noexcept {
+        node->~Node();
+        if (InSlab(node)) {
+            if (--slab->live == 0) {
+                ReleaseSlab();
+            }
+        } else {
+            resource->deallocate(node, sizeof(Node), alignof(Node));
+        }
+    }
+
+    template<typename Data>
+    bool List<Data>::InSlab(const Node *node) const noexcept {
+        if (slab == nullptr) {
+            return false;
+        }
+        const Node *first = SlabNodes(slab);
+        return !std::less<const Node *>()(node, first) && std::less<const Node *>()(node, first + slab->capacity);
+    }
+
+    template<typename Data>
+    void List<Data>::ReleaseSlab() noexcept {
+        resource->deallocate(slab, SlabOffset + slab->capacity * sizeof(Node), SlabAlignment);
+        slab = nullptr;
+    }
+
+    template<typename Data>
+    void List<Data>::UnlinkFront() noexcept {
+        Node *temp = head;
+
+        if (head == tail) {
+            head = tail = nullptr;
+        } else {
+            head = head->next;
+        }
+
+        DeleteNode(temp);
+        size--;
+    }
+
     template<typename Data>
     typename List<Data>::Node *List<Data>::GetNodeAt(ulong index) const {
         Node *current = head;
@@ -392,5 +888,26 @@ namespace lasd {
         return current;
     }
 
+    template<typename Data>
+    typename List<Data>::Cursor List<Data>::CursorAt(ulong index) const {
+        return Cursor{GetNodeAt(index), index};
+    }
+
+    template<typename Data>
+    const Data &List<Data>::CursorData(const Cursor &cursor) const {
+        return static_cast<const Node *>(cursor.position)->data;
+    }
+
+    template<typename Data>
+    Data &List<Data>::CursorMutableData(const Cursor &cursor) {
+        return static_cast<Node *>(cursor.position)->data;
+    }
+
+    template<typename Data>
+    void List<Data>::CursorNext(Cursor &cursor) const {
+        cursor.position = static_cast<Node *>(cursor.position)->next;
+        cursor.index++;
+    }
+
     /* ************************************************************************** */
 }
\ No newline at end of file
@@ -3,13 +3,28 @@
 
 /* ************************************************************************** */
 
+#include <cassert>
+#include <functional>
+#include <iterator>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+
 #include "../container/linear.hpp"
+#include "nodepool.hpp"
 
 /* ************************************************************************** */
 
 namespace lasd {
     /* ************************************************************************** */
 
+    // Tag for the arena mode: the container owns a monotonic region from which all its nodes come
+    struct ArenaMode {
+        explicit ArenaMode() = default;
+    };
+
+    /* ************************************************************************** */
+
     template<typename Data>
     class List : virtual public MutableLinearContainer<Data>,
                  virtual public ClearableContainer {
@@ -32,6 +47,10 @@ namespace lasd {
             explicit Node(Data &&value) noexcept : data(std::move(value)) {
             }
 
+            template<typename... Args>
+            explicit Node(std::in_place_t, Args &&... args) : data(std::forward<Args>(args)...) {
+            }
+
             /* ********************************************************************** */
 
             // Copy constructor
@@ -67,22 +86,100 @@ namespace lasd {
         Node *head = nullptr;
         Node *tail = nullptr;
 
+        std::pmr::memory_resource *resource = &NodePool::Default(); // Provenienza dei nodi (di default il pool del thread che alloca)
+        std::pmr::monotonic_buffer_resource *arena = nullptr; // Regione posseduta in modalità arena (resource punta qui)
+
+        // Blocco contiguo creato da Compact(): i nodi seguono l'intestazione, in ordine di lista
+        struct SlabHeader {
+            unsigned long capacity;
+            unsigned long live; // Nodi non ancora rimossi: a zero il blocco torna alla risorsa
+        };
+
+        static constexpr std::size_t SlabOffset = (sizeof(SlabHeader) + alignof(Node) - 1) / alignof(Node) * alignof(Node);
+        static constexpr std::size_t SlabAlignment = (alignof(Node) > alignof(SlabHeader)) ? alignof(Node) : alignof(SlabHeader);
+
+        SlabHeader *slab = nullptr; // Al più uno: ogni Compact() svuota il precedente
+
     public:
+        // Forward iterator walking the next pointers (const and mutable variants)
+        template<bool Const>
+        class Iterator {
+            friend class List;
+            friend class Iterator<!Const>;
+
+            using NodePointer = std::conditional_t<Const, const Node *, Node *>;
+
+            NodePointer current = nullptr;
+
+            explicit Iterator(NodePointer node) noexcept : current(node) {
+            }
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = Data;
+            using difference_type = std::ptrdiff_t;
+            using pointer = std::conditional_t<Const, const Data *, Data *>;
+            using reference = std::conditional_t<Const, const Data &, Data &>;
+
+            Iterator() = default;
+
+            // Conversion from mutable to const iterator
+            template<bool OtherConst> requires (Const && !OtherConst)
+            Iterator(const Iterator<OtherConst> &other) noexcept : current(other.current) {
+            }
+
+            reference operator*() const noexcept {
+                return current->data;
+            }
+
+            pointer operator->() const noexcept {
+                return &current->data;
+            }
+
+            Iterator &operator++() noexcept {
+                current = current->next;
+                return *this;
+            }
+
+            Iterator operator++(int) noexcept {
+                Iterator previous = *this;
+                current = current->next;
+                return previous;
+            }
+
+            bool operator==(const Iterator &) const noexcept = default;
+        };
+
+        // STL-compatible member types
+        using value_type = Data;
+        using size_type = ulong;
+        using difference_type = std::ptrdiff_t;
+        using reference = Data &;
+        using const_reference = const Data &;
+        using iterator = Iterator<false>;
+        using const_iterator = Iterator<true>;
+
+        /* ************************************************************************ */
+
         // Default constructor
         List() = default;
 
         /* ************************************************************************ */
 
-        // Specific constructor
-        List(const TraversableContainer<Data> &container); // A list obtained from a TraversableContainer
-        List(MappableContainer<Data> &&container); // A list obtained from a MappableContainer
+        // Specific constructor (the nodes come from the given memory resource, NodePool::Default() otherwise)
+        explicit List(std::pmr::memory_resource &memoryResource) noexcept; // An empty list allocating from memoryResource
+        explicit List(ArenaMode); // An empty list owning its arena: Clear and the destructor release it in one go
+        List(const TraversableContainer<Data> &container, std::pmr::memory_resource &memoryResource = NodePool::Default()); // A list obtained from a TraversableContainer
+        List(MappableContainer<Data> &&container, std::pmr::memory_resource &memoryResource = NodePool::Default()); // A list obtained from a MappableContainer
 
         /* ************************************************************************ */
 
-        // Copy constructor
+        // Copy constructor (as for std::pmr containers, the copy uses the default resource, here NodePool::Default(), unless one is given;
+        // the copy of a list in arena mode gets an arena of its own)
         List(const List &other);
+        List(const List &other, std::pmr::memory_resource &memoryResource);
 
-        // Move constructor
+        // Move constructor (takes over the nodes together with their resource)
         List(List &&other) noexcept;
 
         /* ************************************************************************ */
@@ -92,11 +189,12 @@ namespace lasd {
 
         /* ************************************************************************ */
 
-        // Copy assignment
+        // Copy assignment (the list keeps its own resource)
         List &operator=(const List &other);
 
-        // Move assignment
-        List &operator=(List &&other) noexcept;
+        // Move assignment (steals the nodes when the resources are equal, otherwise moves the elements into its own:
+        // that allocates, so unlike the move constructor it is not noexcept, as for std::pmr)
+        List &operator=(List &&other);
 
         /* ************************************************************************ */
 
@@ -112,16 +210,34 @@ namespace lasd {
 
         // Specific member functions
 
+        std::pmr::memory_resource *Resource() const noexcept { // Memory resource of the nodes
+            return resource;
+        }
+
+        bool OwnsArena() const noexcept { // Arena mode
+            return arena != nullptr;
+        }
+
+        void Compact(); // Moves the nodes into one contiguous block in list order (order, values and hash unchanged)
+
         void InsertAtFront(const Data &value); // Copy of the value
         void InsertAtFront(Data &&value) noexcept; // Move of the value
+        template<typename... Args>
+        Data &EmplaceAtFront(Args &&... args); // Element built in the new node from the arguments
         void RemoveFromFront(); // (must throw std::length_error when empty)
         Data FrontNRemove(); // (must throw std::length_error when empty)
 
         void InsertAtBack(const Data &value); // Copy of the value
         void InsertAtBack(Data &&value) noexcept; // Move of the value
+        template<typename... Args>
+        Data &EmplaceAtBack(Args &&... args); // Element built in the new node from the arguments
         void RemoveFromBack(); // (must throw std::length_error when empty)
         Data BackNRemove(); // (must throw std::length_error when empty)
 
+        // Unlinks every element satisfying the predicate in one walk; returns the number of elements removed
+        template<RemovePredicate<Data> Fun>
+        ulong RemoveIf(Fun &&fun);
+
         /* ************************************************************************ */
 
         // Specific member functions (inherited from MutableLinearContainer)
@@ -146,6 +262,27 @@ namespace lasd {
 
         const Data &Back() const override; // Override LinearContainer member (must throw std::length_error when empty)
 
+        const Data *TryFront() const noexcept override; // Override LinearContainer member
+
+        const Data *TryBack() const noexcept override; // Override LinearContainer member
+
+        /* ************************************************************************ */
+
+        // Unchecked access for validated hot loops: no emptiness or bounds check, only an assert in
+        // debug builds (compile with NDEBUG to remove it); UncheckedAt still walks index nodes
+
+        Data &UncheckedAt(ulong index) noexcept;
+
+        const Data &UncheckedAt(ulong index) const noexcept;
+
+        Data &UncheckedFront() noexcept;
+
+        const Data &UncheckedFront() const noexcept;
+
+        Data &UncheckedBack() noexcept;
+
+        const Data &UncheckedBack() const noexcept;
+
         /* ************************************************************************ */
 
         // Specific member function (inherited from MappableContainer)
@@ -174,28 +311,257 @@ namespace lasd {
 
         void Traverse(TraverseFun fun) const override; // Override TraversableContainer member
 
+        using typename TraversableContainer<Data>::TraverseWhileFun;
+
+        bool TraverseWhile(TraverseWhileFun fun) const override; // Override TraversableContainer member
+
+        using typename TraversableContainer<Data>::ChunkFun;
+
+        void TraverseChunks(ChunkFun fun) const override; // Override TraversableContainer member (staging buffer)
+
         /* ************************************************************************ */
 
         // Specific member function (inherited from PreOrderTraversableContainer)
 
         void PreOrderTraverse(TraverseFun fun) const override; // Override PreOrderTraversableContainer member
 
+        bool PreOrderTraverseWhile(TraverseWhileFun fun) const override; // Override PreOrderTraversableContainer member
+
         /* ************************************************************************ */
 
         // Specific member function (inherited from PostOrderTraversableContainer)
 
         void PostOrderTraverse(TraverseFun fun) const override; // Override PostOrderTraversableContainer member
 
+        bool PostOrderTraverseWhile(TraverseWhileFun fun) const override; // Override PostOrderTraversableContainer member
+
+        /* ************************************************************************ */
+
+        // Statically dispatched overloads for generic callables (direct walk on the nodes)
+
+        using LinearContainer<Data>::Fold;
+        using LinearContainer<Data>::PreOrderFold;
+        using LinearContainer<Data>::PostOrderFold;
+
+        template<TraverseCallable<Data> Fun>
+        void Traverse(Fun &&fun) const;
+
+        template<TraverseCallable<Data> Fun>
+        void PreOrderTraverse(Fun &&fun) const;
+
+        template<TraverseCallable<Data> Fun>
+        void PostOrderTraverse(Fun &&fun) const;
+
+        template<typename Accumulator, typename Fun> requires FoldCallable<Fun, Data, Accumulator>
+        Accumulator Fold(Fun &&fun, const Accumulator &acc) const;
+
+        template<typename Accumulator, typename Fun> requires FoldCallable<Fun, Data, Accumulator>
+        Accumulator PreOrderFold(Fun &&fun, const Accumulator &acc) const;
+
+        template<typename Accumulator, typename Fun> requires FoldCallable<Fun, Data, Accumulator>
+        Accumulator PostOrderFold(Fun &&fun, const Accumulator &acc) const;
+
+        template<typename Accumulator, typename Fun> requires FoldMoveCallable<Fun, Data, Accumulator>
+        Accumulator FoldMove(Fun &&fun, Accumulator acc) const;
+
+        template<typename Accumulator, typename Fun> requires FoldMoveCallable<Fun, Data, Accumulator>
+        Accumulator PreOrderFoldMove(Fun &&fun, Accumulator acc) const;
+
+        template<typename Accumulator, typename Fun> requires FoldMoveCallable<Fun, Data, Accumulator>
+        Accumulator PostOrderFoldMove(Fun &&fun, Accumulator acc) const;
+
+        template<MapCallable<Data> Fun>
+        void Map(Fun &&fun);
+
+        template<MapCallable<Data> Fun>
+        void PreOrderMap(Fun &&fun);
+
+        template<MapCallable<Data> Fun>
+        void PostOrderMap(Fun &&fun);
+
+        /* ************************************************************************ */
+
+        // Iterators (an iterator is invalidated only when its node is removed; the mutable ones drop the cached hash)
+
+        iterator begin() noexcept {
+            this->InvalidateHash();
+            return iterator(head);
+        }
+
+        iterator end() noexcept {
+            this->InvalidateHash();
+            return iterator();
+        }
+
+        const_iterator begin() const noexcept { return const_iterator(head); }
+        const_iterator end() const noexcept { return const_iterator(); }
+
+        const_iterator cbegin() const noexcept { return const_iterator(head); }
+        const_iterator cend() const noexcept { return const_iterator(); }
+
         /* ************************************************************************ */
 
         // Specific member function (inherited from ClearableContainer)
 
-        void Clear() override; // Override ClearableContainer member
+        void Clear() override; // Override ClearableContainer member (O(1) in arena mode with trivially destructible Data)
 
     protected:
         // Auxiliary functions
 
         Node *GetNodeAt(ulong index) const;
+
+        void UnlinkFront() noexcept; // Deletes the head node (list not empty), without touching the hash
+
+        explicit List(std::pmr::monotonic_buffer_resource *ownedArena) noexcept; // Arena mode when ownedArena is not null
+
+        static std::pmr::monotonic_buffer_resource *NewArena();
+
+        // Node storage from the list resource
+        template<typename... Args>
+        Node *NewNode(Args &&... args);
+
+        void DeleteNode(Node *node) noexcept;
+
+        // Compacted block
+        static Node *SlabNodes(SlabHeader *header) noexcept {
+            return reinterpret_cast<Node *>(reinterpret_cast<char *>(header) + SlabOffset);
+        }
+
+        bool InSlab(const Node *node) const noexcept;
+
+        void ReleaseSlab() noexcept;
+
+        // Cursor protocol (inherited from LinearContainer): one next hop per step
+
+        using typename LinearContainer<Data>::Cursor;
+
+        Cursor CursorAt(ulong index) const override;
+
+        const Data &CursorData(const Cursor &cursor) const override;
+
+        Data &CursorMutableData(const Cursor &cursor) override;
+
+        void CursorNext(Cursor &cursor) const override;
+    };
+
+    /* ************************************************************************** */
+
+    // Statically dispatched List: calls on a FinalList bind at compile time and inline, and the size is
+    // read without the virtual-base pointer. It is still a List for generic code.
+
+    template<typename Data>
+    class FinalList final : public List<Data> {
+    protected:
+        using Container::size;
+        using List<Data>::head;
+        using List<Data>::tail;
+
+    public:
+        // Default constructor
+        FinalList() = default;
+
+        /* ************************************************************************ */
+
+        // Specific constructors
+        FinalList(const TraversableContainer<Data> &container) : List<Data>(container) {
+        } // A list obtained from a TraversableContainer
+
+        FinalList(MappableContainer<Data> &&container) : List<Data>(std::move(container)) {
+        } // A list obtained from a MappableContainer
+
+        /* ************************************************************************ */
+
+        // Copy constructor
+        FinalList(const FinalList &other) : List<Data>(other) {
+        }
+
+        // Move constructor
+        FinalList(FinalList &&other) noexcept : List<Data>(std::move(other)) {
+        }
+
+        /* ************************************************************************ */
+
+        // Destructor
+        ~FinalList() = default;
+
+        /* ************************************************************************ */
+
+        // Copy assignment
+        FinalList &operator=(const FinalList &other) {
+            List<Data>::operator=(other);
+            return *this;
+        }
+
+        // Move assignment
+        FinalList &operator=(FinalList &&other) {
+            List<Data>::operator=(std::move(other));
+            return *this;
+        }
+
+        /* ************************************************************************ */
+
+        // Specific member functions (statically dispatched, same contracts as in List)
+
+        ulong Size() const noexcept {
+            return size;
+        }
+
+        bool Empty() const noexcept {
+            return (size == 0);
+        }
+
+        Data &operator[](ulong index) override { // (must throw std::out_of_range when out of range)
+            if (index >= size) {
+                throw std::out_of_range("Index out of range");
+            }
+            this->InvalidateHash();
+            return this->GetNodeAt(index)->data;
+        }
+
+        const Data &operator[](ulong index) const override { // (must throw std::out_of_range when out of range)
+            if (index >= size) {
+                throw std::out_of_range("Index out of range");
+            }
+            return this->GetNodeAt(index)->data;
+        }
+
+        Data &Front() override { // (must throw std::length_error when empty)
+            if (head == nullptr) {
+                throw std::length_error("Empty list");
+            }
+            this->InvalidateHash();
+            return head->data;
+        }
+
+        const Data &Front() const override { // (must throw std::length_error when empty)
+            if (head == nullptr) {
+                throw std::length_error("Empty list");
+            }
+            return head->data;
+        }
+
+        Data &Back() override { // (must throw std::length_error when empty)
+            if (tail == nullptr) {
+                throw std::length_error("Empty list");
+            }
+            this->InvalidateHash();
+            return tail->data;
+        }
+
+        const Data &Back() const override { // (must throw std::length_error when empty)
+            if (tail == nullptr) {
+                throw std::length_error("Empty list");
+            }
+            return tail->data;
+        }
+
+        const Data *TryFront() const noexcept override {
+            return (head == nullptr) ? nullptr : &head->data;
+        }
+
+        const Data *TryBack() const noexcept override {
+            return (tail == nullptr) ? nullptr : &tail->data;
+        }
     };
 
     /* ************************************************************************** */
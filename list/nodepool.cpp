@@ -0,0 +1,342 @@
+#include <cassert>
+#include <new>
+
+namespace lasd {
+    /* ************************************************************************** */
+
+    // Classe non template: le definizioni sono inline perché il file è incluso da più unità di traduzione
+
+    // Default constructor
+    inline NodePool::NodePool(std::pmr::memory_resource &upstreamResource, unsigned long idleSlabLimit) noexcept
+        : upstream(&upstreamResource), idleLimit(idleSlabLimit) {
+    }
+
+    // Destructor
+    inline NodePool::~NodePool() {
+        assert(inUse == 0);
+        Release();
+    }
+
+    /* ************************************************************************** */
+
+    // Specific member functions
+    inline NodePool &NodePool::Local() {
+        return ThreadNodePool::Local();
+    }
+
+    inline std::pmr::memory_resource &NodePool::Default() noexcept {
+        static ThreadNodeResource *const resource = new ThreadNodeResource(); // Mai distrutta: le liste statiche la usano fino all'ultimo
+        return *resource;
+    }
+
+    inline bool NodePool::Release() noexcept {
+        Collect();
+        if (inUse != 0) {
+            return false;
+        }
+
+        while (slabs != nullptr) {
+            Slab *next = slabs->next;
+            upstream->deallocate(slabs, SlabBytes, SlabBytes);
+            slabs = next;
+        }
+        slabCount = 0;
+        idleSlabs = 0;
+        for (std::size_t index = 0; index < SizeClasses; index++) {
+            openSlabs[index] = nullptr;
+            freeCounts[index] = 0;
+        }
+        return true;
+    }
+
+    inline unsigned long NodePool::Trim(unsigned long keepIdle) noexcept {
+        Collect();
+        unsigned long trimmed = 0;
+        unsigned long kept = 0;
+        Slab *slab = slabs;
+        while (slab != nullptr) {
+            Slab *next = slab->next;
+            if (slab->live == 0) {
+                if (kept < keepIdle) {
+                    kept++;
+                } else {
+                    ReturnSlab(slab);
+                    trimmed++;
+                }
+            }
+            slab = next;
+        }
+        return trimmed;
+    }
+
+    inline unsigned long NodePool::FreeCount() const noexcept {
+        unsigned long total = 0;
+        for (std::size_t index = 0; index < SizeClasses; index++) {
+            total += freeCounts[index];
+        }
+        return total;
+    }
+
+    inline unsigned long NodePool::FreeCount(std::size_t bytes) const noexcept {
+        return (bytes <= MaxBlockBytes) ? freeCounts[ClassOf(bytes)] : 0;
+    }
+
+    /* ************************************************************************** */
+
+    // Auxiliary functions
+    inline NodePool::Slab *NodePool::Refill(std::size_t sizeClass) {
+        // Allineata alla sua dimensione: SlabOf ritrova l'intestazione dall'indirizzo di un blocco
+        Slab *slab = ::new(upstream->allocate(SlabBytes, SlabBytes)) Slab{};
+        slab->sizeClass = sizeClass;
+        slab->owner = this;
+        slab->next = slabs;
+        if (slabs != nullptr) {
+            slabs->previous = slab;
+        }
+        slabs = slab;
+        slabCount++;
+        idleSlabs++;
+
+        // Inseriti al contrario, così i nodi consecutivi escono in ordine di indirizzo
+        const std::size_t blockBytes = BlockBytes(sizeClass);
+        const std::size_t blocks = BlocksPerSlab(sizeClass);
+        char *first = reinterpret_cast<char *>(slab) + SlabHeaderBytes;
+        for (std::size_t index = blocks; index > 0; index--) {
+            slab->free = ::new(first + (index - 1) * blockBytes) FreeBlock{slab->free};
+        }
+        freeCounts[sizeClass] += blocks;
+        Open(slab);
+        return slab;
+    }
+
+    inline void NodePool::Open(Slab *slab) noexcept {
+        Slab *&head = openSlabs[slab->sizeClass];
+        slab->previousOpen = nullptr;
+        slab->nextOpen = head;
+        if (head != nullptr) {
+            head->previousOpen = slab;
+        }
+        head = slab;
+    }
+
+    inline void NodePool::Close(Slab *slab) noexcept {
+        if (slab->previousOpen != nullptr) {
+            slab->previousOpen->nextOpen = slab->nextOpen;
+        } else {
+            openSlabs[slab->sizeClass] = slab->nextOpen;
+        }
+        if (slab->nextOpen != nullptr) {
+            slab->nextOpen->previousOpen = slab->previousOpen;
+        }
+    }
+
+    inline void NodePool::ReturnSlab(Slab *slab) noexcept {
+        // Inattiva: tutti i suoi blocchi sono liberi, quindi è aperta
+        Close(slab);
+        if (slab->previous != nullptr) {
+            slab->previous->next = slab->next;
+        } else {
+            slabs = slab->next;
+        }
+        if (slab->next != nullptr) {
+            slab->next->previous = slab->previous;
+        }
+        freeCounts[slab->sizeClass] -= BlocksPerSlab(slab->sizeClass);
+        slabCount--;
+        idleSlabs--;
+        upstream->deallocate(slab, SlabBytes, SlabBytes);
+    }
+
+    /* ************************************************************************** */
+
+    // Specific member functions (inherited from memory_resource)
+    inline void *NodePool::do_allocate(std::size_t bytes, std::size_t alignment) {
+        void *pointer;
+        if (Pooled(bytes, alignment)) {
+            const std::size_t sizeClass = ClassOf(bytes);
+            Slab *slab = openSlabs[sizeClass];
+            if (slab == nullptr) {
+                slab = Refill(sizeClass);
+            }
+
+            FreeBlock *block = slab->free;
+            slab->free = block->next;
+            if (slab->free == nullptr) {
+                Close(slab);
+            }
+            if (slab->live++ == 0) {
+                idleSlabs--;
+            }
+            freeCounts[sizeClass]--;
+            pointer = block;
+        } else {
+            pointer = upstream->allocate(bytes, alignment);
+        }
+
+        inUse++;
+        return pointer;
+    }
+
+    inline void NodePool::do_deallocate(void *pointer, std::size_t bytes, std::size_t alignment) {
+        if (Pooled(bytes, alignment)) {
+            Slab *slab = SlabOf(pointer);
+            if (slab->free == nullptr) {
+                Open(slab);
+            }
+            slab->free = ::new(pointer) FreeBlock{slab->free};
+            freeCounts[slab->sizeClass]++;
+            if (--slab->live == 0 && ++idleSlabs > idleLimit) {
+                ReturnSlab(slab);
+            }
+        } else {
+            upstream->deallocate(pointer, bytes, alignment);
+        }
+        inUse--;
+    }
+
+    inline bool NodePool::do_is_equal(const std::pmr::memory_resource &other) const noexcept {
+        return this == &other;
+    }
+
+    /* ************************************************************************** */
+
+    /* ************************************************************************** */
+
+    // Specific member functions
+    inline ThreadNodePool &ThreadNodePool::Local() {
+        // Il pool sopravvive al thread finché non rientrano tutti i suoi blocchi (es. liste statiche distrutte dopo)
+        struct Owner {
+            ThreadNodePool *pool = new ThreadNodePool();
+
+            Owner() noexcept {
+                current = pool;
+            }
+
+            ~Owner() {
+                current = nullptr;
+                pool->Retire();
+            }
+        };
+
+        thread_local Owner owner;
+        return *owner.pool;
+    }
+
+    /* ************************************************************************** */
+
+    // Auxiliary functions
+    inline void ThreadNodePool::Collect() noexcept {
+        if (foreignCount.load(std::memory_order_relaxed) == 0) {
+            return;
+        }
+
+        FreeBlock *blocks;
+        unsigned long forwarded;
+        {
+            std::lock_guard<std::mutex> lock(foreignLock);
+            blocks = foreignBlocks;
+            forwarded = foreignForwarded;
+            foreignBlocks = nullptr;
+            foreignForwarded = 0;
+            foreignCount.store(0, std::memory_order_relaxed);
+        }
+        TakeBack(blocks, forwarded);
+    }
+
+    inline void ThreadNodePool::TakeBack(FreeBlock *blocks, unsigned long forwarded) noexcept {
+        while (blocks != nullptr) {
+            FreeBlock *next = blocks->next;
+            NodePool::do_deallocate(blocks, BlockBytes(SlabOf(blocks)->sizeClass), alignof(FreeBlock));
+            blocks = next;
+        }
+        inUse -= forwarded;
+    }
+
+    inline void ThreadNodePool::ForeignDeallocate(void *pointer, std::size_t bytes, std::size_t alignment) noexcept {
+        bool release = false;
+        {
+            std::lock_guard<std::mutex> lock(foreignLock);
+            if (retired) { // Nessun proprietario: il lock basta a serializzare
+                NodePool::do_deallocate(pointer, bytes, alignment);
+                release = (inUse == 0);
+            } else {
+                if (Pooled(bytes, alignment)) {
+                    foreignBlocks = ::new(pointer) FreeBlock{foreignBlocks};
+                } else {
+                    upstream->deallocate(pointer, bytes, alignment); // new/delete, già sincronizzata
+                    foreignForwarded++;
+                }
+                foreignCount.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        if (release) {
+            delete this;
+        }
+    }
+
+    inline void ThreadNodePool::Retire() noexcept {
+        bool release;
+        {
+            std::lock_guard<std::mutex> lock(foreignLock);
+            retired = true;
+            TakeBack(foreignBlocks, foreignForwarded);
+            foreignBlocks = nullptr;
+            foreignForwarded = 0;
+            foreignCount.store(0, std::memory_order_relaxed);
+            release = (inUse == 0);
+        }
+        if (release) {
+            delete this;
+        }
+    }
+
+    /* ************************************************************************** */
+
+    // Specific member functions (inherited from memory_resource)
+    inline void *ThreadNodePool::do_allocate(std::size_t bytes, std::size_t alignment) {
+        Collect();
+        return NodePool::do_allocate(bytes, alignment);
+    }
+
+    inline void ThreadNodePool::do_deallocate(void *pointer, std::size_t bytes, std::size_t alignment) {
+        if (current == this) {
+            NodePool::do_deallocate(pointer, bytes, alignment);
+        } else {
+            ForeignDeallocate(pointer, bytes, alignment);
+        }
+    }
+
+    /* ************************************************************************** */
+
+    // Specific member functions (inherited from memory_resource)
+    inline void *ThreadNodeResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+        if (NodePool::Pooled(bytes, alignment)) {
+            ThreadNodePool *pool = ThreadNodePool::current;
+            if (pool == nullptr) {
+                pool = &ThreadNodePool::Local();
+            }
+            pool->Collect();
+            return pool->NodePool::do_allocate(bytes, alignment);
+        }
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    inline void ThreadNodeResource::do_deallocate(void *pointer, std::size_t bytes, std::size_t alignment) {
+        if (NodePool::Pooled(bytes, alignment)) {
+            ThreadNodePool &owner = ThreadNodePool::OwnerOf(pointer);
+            if (&owner == ThreadNodePool::current) {
+                owner.NodePool::do_deallocate(pointer, bytes, alignment);
+            } else {
+                owner.ForeignDeallocate(pointer, bytes, alignment);
+            }
+        } else {
+            std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+        }
+    }
+
+    inline bool ThreadNodeResource::do_is_equal(const std::pmr::memory_resource &other) const noexcept {
+        return this == &other;
+    }
+
+    /* ************************************************************************** */
+}
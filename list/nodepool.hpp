@@ -0,0 +1,239 @@
+#ifndef NODEPOOL_HPP
+#define NODEPOOL_HPP
+
+/* ************************************************************************** */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <mutex>
+
+/* ************************************************************************** */
+
+namespace lasd {
+    /* ************************************************************************** */
+
+    // Size-class pool for list nodes: blocks up to MaxBlockBytes are cut from slabs of SlabBytes taken
+    // from the upstream resource, and a freed block goes back on the free list of its slab. A slab with
+    // no block in use is idle: beyond idleLimit of them it returns upstream at once, Trim and Release
+    // return the others on request. Larger or over-aligned requests go upstream.
+    // A NodePool is not synchronized: List and SetLst use by default Default(), which allocates from the
+    // pool of the calling thread (Local()) and sends every block back to the pool that cut it, even when
+    // it is freed on another thread (see ThreadNodePool).
+
+    class NodePool : public std::pmr::memory_resource {
+    public:
+        static constexpr std::size_t Granularity = 8; // Distanza tra due classi di dimensione
+        static constexpr std::size_t MaxBlockBytes = 256;
+        static constexpr std::size_t SizeClasses = MaxBlockBytes / Granularity;
+        static constexpr std::size_t SlabBytes = 16384; // Also the alignment of a slab (its header is found by masking)
+
+        static constexpr unsigned long DefaultIdleLimit = 8;
+        static constexpr unsigned long NoIdleLimit = ~0UL; // Idle slabs stay until Trim or Release
+
+    protected:
+        struct FreeBlock {
+            FreeBlock *next;
+        };
+
+        // Intestazione in testa a ogni slab: una slab sta nella lista di tutte le slab e, finché ha blocchi
+        // liberi, in quella delle slab aperte della sua classe (entrambe doppie, per toglierla in O(1))
+        struct Slab {
+            Slab *previous = nullptr;
+            Slab *next = nullptr;
+            Slab *previousOpen = nullptr;
+            Slab *nextOpen = nullptr;
+            FreeBlock *free = nullptr;
+            unsigned long live = 0; // Blocchi della slab in uso
+            std::size_t sizeClass;
+            NodePool *owner; // Pool che ha ritagliato la slab
+        };
+
+        // Blocchi a partire da un offset allineato come max_align_t
+        static constexpr std::size_t SlabHeaderBytes = (sizeof(Slab) + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+
+        std::pmr::memory_resource *upstream;
+
+        Slab *openSlabs[SizeClasses] = {};
+        unsigned long freeCounts[SizeClasses] = {};
+
+        Slab *slabs = nullptr;
+        unsigned long slabCount = 0;
+        unsigned long idleSlabs = 0;
+        unsigned long idleLimit;
+        unsigned long inUse = 0;
+
+    public:
+        // Default constructor
+        explicit NodePool(std::pmr::memory_resource &upstreamResource = *std::pmr::new_delete_resource(), unsigned long idleSlabLimit = DefaultIdleLimit) noexcept;
+
+        /* ************************************************************************ */
+
+        // Copy constructor
+        NodePool(const NodePool &) = delete;
+
+        // Move constructor
+        NodePool(NodePool &&) = delete;
+
+        /* ************************************************************************ */
+
+        // Destructor (every block must have been returned)
+        ~NodePool() override;
+
+        /* ************************************************************************ */
+
+        // Copy assignment
+        NodePool &operator=(const NodePool &) = delete;
+
+        // Move assignment
+        NodePool &operator=(NodePool &&) = delete;
+
+        /* ************************************************************************ */
+
+        // Specific member functions
+
+        static NodePool &Local(); // Pool of the calling thread (to be used on that thread only)
+
+        static std::pmr::memory_resource &Default() noexcept; // Pool of the calling thread, frees routed to the owning pool: the default of List and SetLst
+
+        bool Release() noexcept; // Returns every slab upstream, only if no block is in use
+
+        unsigned long Trim(unsigned long keepIdle = 0) noexcept; // Returns the idle slabs beyond keepIdle upstream, gives their number
+
+        unsigned long SlabCount() const noexcept { // Slabs taken from upstream
+            return slabCount;
+        }
+
+        unsigned long IdleSlabCount() const noexcept { // Slabs with no block in use
+            return idleSlabs;
+        }
+
+        unsigned long FreeCount() const noexcept; // Blocks waiting on the free lists
+        unsigned long FreeCount(std::size_t bytes) const noexcept; // Free blocks of the class serving blocks of bytes
+
+        unsigned long InUse() const noexcept { // Blocks currently handed out (pooled or forwarded upstream)
+            return inUse;
+        }
+
+        static constexpr bool Pooled(std::size_t bytes, std::size_t alignment) noexcept { // Served from a size class
+            return bytes <= MaxBlockBytes && alignment <= alignof(std::max_align_t) && BlockBytes(ClassOf(bytes)) % alignment == 0;
+        }
+
+    protected:
+        // Auxiliary functions
+
+        static constexpr std::size_t ClassOf(std::size_t bytes) noexcept {
+            return (bytes == 0) ? 0 : (bytes - 1) / Granularity;
+        }
+
+        static constexpr std::size_t BlockBytes(std::size_t sizeClass) noexcept {
+            return (sizeClass + 1) * Granularity;
+        }
+
+        static Slab *SlabOf(void *block) noexcept {
+            return reinterpret_cast<Slab *>(reinterpret_cast<std::uintptr_t>(block) & ~static_cast<std::uintptr_t>(SlabBytes - 1));
+        }
+
+        static constexpr std::size_t BlocksPerSlab(std::size_t sizeClass) noexcept {
+            return (SlabBytes - SlabHeaderBytes) / BlockBytes(sizeClass);
+        }
+
+        Slab *Refill(std::size_t sizeClass); // Cuts a new slab into free blocks and opens it
+
+        void Open(Slab *slab) noexcept; // Puts the slab at the head of the open slabs of its class
+
+        void Close(Slab *slab) noexcept; // Takes the slab out of the open slabs of its class
+
+        void ReturnSlab(Slab *slab) noexcept; // Gives an idle slab back upstream
+
+        virtual void Collect() noexcept { // Takes back the blocks freed elsewhere (before Trim and Release)
+        }
+
+        /* ************************************************************************ */
+
+        // Specific member functions (inherited from memory_resource)
+
+        void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+
+        void do_deallocate(void *pointer, std::size_t bytes, std::size_t alignment) override;
+
+        bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override;
+    };
+
+    /* ************************************************************************** */
+
+    // Pool of one thread, behind Local() and Default(). The owning thread allocates and frees without
+    // synchronization; another thread hands its frees over under a lock, and the owner takes them back at
+    // its next allocation (or Trim, Release). After its thread has ended the pool frees under the lock,
+    // and lives on until every block has come back.
+
+    class ThreadNodePool final : public NodePool {
+        friend class ThreadNodeResource; // Chiama direttamente i percorsi non virtuali
+
+    protected:
+        static inline thread_local ThreadNodePool *current = nullptr; // Pool del thread in esecuzione, finché è attivo
+
+        // Blocchi restituiti da altri thread e non ancora ripresi dal proprietario, protetti da foreignLock
+        // (quelli fuori classe tornano subito a new/delete, resta da scalarli da inUse)
+        std::mutex foreignLock;
+        FreeBlock *foreignBlocks = nullptr;
+        unsigned long foreignForwarded = 0;
+        bool retired = false;
+        std::atomic<unsigned long> foreignCount{0}; // Letto senza lock dal proprietario a ogni allocazione
+
+    public:
+        // Specific member functions
+
+        static ThreadNodePool &Local(); // Pool of the calling thread, created on first use
+
+        static ThreadNodePool &OwnerOf(void *block) noexcept { // Pool that cut a pooled block
+            return *static_cast<ThreadNodePool *>(SlabOf(block)->owner);
+        }
+
+        unsigned long ForeignCount() const noexcept { // Blocks freed by other threads, not yet taken back
+            return foreignCount.load(std::memory_order_acquire);
+        }
+
+    protected:
+        // Auxiliary functions
+
+        void Collect() noexcept override; // Takes back the blocks freed by other threads (owning thread)
+
+        void ForeignDeallocate(void *pointer, std::size_t bytes, std::size_t alignment) noexcept; // A free from another thread
+
+        void TakeBack(FreeBlock *blocks, unsigned long forwarded) noexcept; // Frees the blocks handed over by other threads
+
+        void Retire() noexcept; // End of the owning thread
+
+        /* ************************************************************************ */
+
+        // Specific member functions (inherited from memory_resource)
+
+        void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+
+        void do_deallocate(void *pointer, std::size_t bytes, std::size_t alignment) override;
+    };
+
+    /* ************************************************************************** */
+
+    // Resource returned by NodePool::Default(): stateless, it allocates from the pool of the calling thread
+    // and frees on the pool that cut the block; blocks the pools would forward go straight to new/delete
+
+    class ThreadNodeResource final : public std::pmr::memory_resource {
+    protected:
+        // Specific member functions (inherited from memory_resource)
+
+        void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+
+        void do_deallocate(void *pointer, std::size_t bytes, std::size_t alignment) override;
+
+        bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override;
+    };
+
+    /* ************************************************************************** */
+}
+
+#include "nodepool.cpp"
+
+#endif
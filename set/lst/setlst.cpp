@@ -3,95 +3,105 @@ namespace lasd {
 /* ************************************************************************** */
 
 // Auxiliary protected functions
-template <typename Data>
-void SetLst<Data>::InsertInOrder(const Data& data) {
-  if (size == 0 || data <= head->data) {
-    // Inserimento in testa
-    this->InsertAtFront(data);
-    return;
-  }
-
-  // Trovo la posizione corretta
+template <typename Data, typename Compare>
+template <typename... Args>
+bool SetLst<Data, Compare>::EmplaceUnique(const Data& key, Args&&... args) {
+  // Un'unica scansione: trovo il predecessore e controllo il duplicato prima di allocare il nodo
+  typename List<Data>::Node* previous = nullptr;
   typename List<Data>::Node* current = head;
-  while (current->next != nullptr && current->next->data < data) {
+  while (current != nullptr) {
+    auto order = compare(current->data, key);
+    if (order == 0) {
+      return false;
+    }
+    if (order > 0) {
+      break;
+    }
+    previous = current;
     current = current->next;
   }
 
-  // Creo un nuovo nodo
-  typename List<Data>::Node* newNode = new typename List<Data>::Node(data);
+  // Creo un nuovo nodo costruendo il dato direttamente al suo interno
+  typename List<Data>::Node* newNode = this->NewNode(std::in_place, std::forward<Args>(args)...);
 
   // Lo inserisco nella lista
-  newNode->next = current->next;
-  current->next = newNode;
+  newNode->next = current;
+  if (previous == nullptr) {
+    head = newNode;
+  } else {
+    previous->next = newNode;
+  }
 
   // Se inserito alla fine, aggiorno tail
-  if (newNode->next == nullptr) {
+  if (current == nullptr) {
     List<Data>::tail = newNode;
   }
 
   size++;
+  this->HashInserted(newNode->data);
+  return true;
 }
 
-template <typename Data>
-void SetLst<Data>::InsertInOrder(Data&& data) {
-  if (size == 0 || data <= head->data) {
-    // Inserimento in testa
-    this->InsertAtFront(std::move(data));
+template <typename Data, typename Compare>
+void SetLst<Data, Compare>::Unlink(typename List<Data>::Node* node) noexcept {
+  if (node == head) {
+    this->UnlinkFront();
     return;
   }
 
-  // Trovo la posizione corretta
   typename List<Data>::Node* current = head;
-  while (current->next != nullptr && current->next->data < data) {
+  while (current->next != node) {
     current = current->next;
   }
 
-  // Creo un nuovo nodo
-  typename List<Data>::Node* newNode = new typename List<Data>::Node(std::move(data));
-
-  // Lo inserisco nella lista
-  newNode->next = current->next;
-  current->next = newNode;
+  current->next = node->next;
 
-  // Se inserito alla fine, aggiorno tail
-  if (newNode->next == nullptr) {
-    List<Data>::tail = newNode;
+  if (node == List<Data>::tail) {
+    List<Data>::tail = current;
   }
 
-  size++;
+  this->DeleteNode(node);
+  size--;
 }
 
-// Specific constructors
+template <typename Data, typename Compare>
+SetLst<Data, Compare>::SetLst(std::pmr::memory_resource& memoryResource) : List<Data>(memoryResource) {}
+
+template <typename Data, typename Compare>
+SetLst<Data, Compare>::SetLst(ArenaMode mode) : List<Data>(mode) {}
 
-template <typename Data>
-SetLst<Data>::SetLst(const TraversableContainer<Data>& container) {
+template <typename Data, typename Compare>
+SetLst<Data, Compare>::SetLst(const TraversableContainer<Data>& container, std::pmr::memory_resource& memoryResource)
+  : List<Data>(memoryResource) {
   container.Traverse([this](const Data& data) {
     this->Insert(data);  // Usa Insert invece di InsertAtBack per garantire unicità
   });
 }
 
-template <typename Data>
-SetLst<Data>::SetLst(MappableContainer<Data>&& container) {
+template <typename Data, typename Compare>
+SetLst<Data, Compare>::SetLst(MappableContainer<Data>&& container, std::pmr::memory_resource& memoryResource)
+  : List<Data>(memoryResource) {
   container.Map([this](Data& data) {
     this->Insert(std::move(data));  // Usa Insert invece di InsertAtBack per garantire unicità
   });
 }
 
 // Copy constructor
-template <typename Data>
-SetLst<Data>::SetLst(const SetLst<Data>& other) : List<Data>() {
+template <typename Data, typename Compare>
+SetLst<Data, Compare>::SetLst(const SetLst<Data, Compare>& other)
+  : List<Data>((other.arena != nullptr) ? List<Data>::NewArena() : nullptr) { // La copia di un set in modalità arena ha la sua arena
   other.Traverse([this](const Data& data) {
     this->Insert(data);  // Usa Insert per mantenere l'ordinamento
   });
 }
 
 // Move constructor
-template <typename Data>
-SetLst<Data>::SetLst(SetLst<Data>&& other) noexcept : List<Data>(std::move(other)) {}
+template <typename Data, typename Compare>
+SetLst<Data, Compare>::SetLst(SetLst<Data, Compare>&& other) noexcept : List<Data>(std::move(other)) {}
 
 // Copy assignment
-template <typename Data>
-SetLst<Data>& SetLst<Data>::operator=(const SetLst<Data>& other) {
+template <typename Data, typename Compare>
+SetLst<Data, Compare>& SetLst<Data, Compare>::operator=(const SetLst<Data, Compare>& other) {
   if (this != &other) {
     this->Clear();
     other.Traverse([this](const Data& data) {
@@ -102,36 +112,36 @@ SetLst<Data>& SetLst<Data>::operator=(const SetLst<Data>& other) {
 }
 
 // Move assignment
-template <typename Data>
-SetLst<Data>& SetLst<Data>::operator=(SetLst<Data>&& other) noexcept {
+template <typename Data, typename Compare>
+SetLst<Data, Compare>& SetLst<Data, Compare>::operator=(SetLst<Data, Compare>&& other) {
   List<Data>::operator=(std::move(other));
   return *this;
 }
 
 // Comparison operators
-template <typename Data>
-bool SetLst<Data>::operator==(const SetLst<Data>& other) const noexcept {
+template <typename Data, typename Compare>
+bool SetLst<Data, Compare>::operator==(const SetLst<Data, Compare>& other) const noexcept {
   return List<Data>::operator==(other);
 }
 
-template <typename Data>
-inline bool SetLst<Data>::operator!=(const SetLst<Data>& other) const noexcept {
+template <typename Data, typename Compare>
+inline bool SetLst<Data, Compare>::operator!=(const SetLst<Data, Compare>& other) const noexcept {
   return !(*this == other);
 }
 
 // Specific member functions (inherited from OrderedDictionaryContainer)
 
-template <typename Data>
-const Data& SetLst<Data>::Min() const {
-  if (size == 0) {
-    throw std::length_error("Empty set");
+template <typename Data, typename Compare>
+const Data& SetLst<Data, Compare>::Min() const {
+  if (const Data* min = TryMin()) {
+    return *min;
   }
 
-  return head->data;  // In una lista ordinata, il minimo è in testa
+  throw std::length_error("Empty set");
 }
 
-template <typename Data>
-Data SetLst<Data>::MinNRemove() {
+template <typename Data, typename Compare>
+Data SetLst<Data, Compare>::MinNRemove() {
   if (size == 0) {
     throw std::length_error("Empty set");
   }
@@ -139,8 +149,8 @@ Data SetLst<Data>::MinNRemove() {
   return this->FrontNRemove();  // In una lista ordinata, il minimo è in testa
 }
 
-template <typename Data>
-void SetLst<Data>::RemoveMin() {
+template <typename Data, typename Compare>
+void SetLst<Data, Compare>::RemoveMin() {
   if (size == 0) {
     throw std::length_error("Empty set");
   }
@@ -148,17 +158,17 @@ void SetLst<Data>::RemoveMin() {
   this->RemoveFromFront();  // In una lista ordinata, il minimo è in testa
 }
 
-template <typename Data>
-const Data& SetLst<Data>::Max() const {
-  if (size == 0) {
-    throw std::length_error("Empty set");
+template <typename Data, typename Compare>
+const Data& SetLst<Data, Compare>::Max() const {
+  if (const Data* max = TryMax()) {
+    return *max;
   }
 
-  return List<Data>::tail->data;  // In una lista ordinata, il massimo è in coda
+  throw std::length_error("Empty set");
 }
 
-template <typename Data>
-Data SetLst<Data>::MaxNRemove() {
+template <typename Data, typename Compare>
+Data SetLst<Data, Compare>::MaxNRemove() {
   if (size == 0) {
     throw std::length_error("Empty set");
   }
@@ -166,8 +176,8 @@ Data SetLst<Data>::MaxNRemove() {
   return this->BackNRemove();  // In una lista ordinata, il massimo è in coda
 }
 
-template <typename Data>
-void SetLst<Data>::RemoveMax() {
+template <typename Data, typename Compare>
+void SetLst<Data, Compare>::RemoveMax() {
   if (size == 0) {
     throw std::length_error("Empty set");
   }
@@ -175,276 +185,324 @@ void SetLst<Data>::RemoveMax() {
   this->RemoveFromBack();  // In una lista ordinata, il massimo è in coda
 }
 
-template <typename Data>
-const Data& SetLst<Data>::Predecessor(const Data& data) const {
-  if (size == 0) {
-    throw std::length_error("Empty set");
+template <typename Data, typename Compare>
+const Data& SetLst<Data, Compare>::Predecessor(const Data& data) const {
+  if (const Data* pred = TryPredecessor(data)) {
+    return *pred;
   }
 
-  typename List<Data>::Node* pred = FindPointerToPredecessor(data);
-  if (pred == nullptr) {
-    throw std::length_error("Predecessor not found");
-  }
-
-  return pred->data;
+  throw std::length_error((size == 0) ? "Empty set" : "Predecessor not found");
 }
 
-template <typename Data>
-Data SetLst<Data>::PredecessorNRemove(const Data& data) {
+template <typename Data, typename Compare>
+Data SetLst<Data, Compare>::PredecessorNRemove(const Data& data) {
   if (size == 0) {
     throw std::length_error("Empty set");
   }
 
-  typename List<Data>::Node* pred = FindPointerToPredecessor(data);
+  typename List<Data>::Node* pred = FindPointerToPredecessor(ProbeFor(data));
   if (pred == nullptr) {
     throw std::length_error("Predecessor not found");
   }
 
-  Data value = pred->data;
-
-  if (pred == head) {
-    this->RemoveFromFront();
-  } else {
-    typename List<Data>::Node* current = head;
-    while (current->next != pred) {
-      current = current->next;
-    }
-
-    current->next = pred->next;
-
-    if (pred == List<Data>::tail) {
-      List<Data>::tail = current;
-    }
-
-    delete pred;
-    size--;
-  }
+  Data value = std::move(pred->data);
+  Unlink(pred);
+  this->HashRemoved(value);
 
   return value;
 }
 
-template <typename Data>
-void SetLst<Data>::RemovePredecessor(const Data& data) {
+template <typename Data, typename Compare>
+void SetLst<Data, Compare>::RemovePredecessor(const Data& data) {
   if (size == 0) {
     throw std::length_error("Empty set");
   }
 
-  typename List<Data>::Node* pred = FindPointerToPredecessor(data);
+  typename List<Data>::Node* pred = FindPointerToPredecessor(ProbeFor(data));
   if (pred == nullptr) {
     throw std::length_error("Predecessor not found");
   }
 
-  if (pred == head) {
-    this->RemoveFromFront();
-  } else {
-    typename List<Data>::Node* current = head;
-    while (current->next != pred) {
-      current = current->next;
-    }
-
-    current->next = pred->next;
-
-    if (pred == List<Data>::tail) {
-      List<Data>::tail = current;
-    }
-
-    delete pred;
-    size--;
-  }
+  this->HashRemoved(pred->data);
+  Unlink(pred);
 }
 
-template <typename Data>
-const Data& SetLst<Data>::Successor(const Data& data) const {
-  if (size == 0) {
-    throw std::length_error("Empty set");
-  }
-
-  typename List<Data>::Node* succ = FindPointerToSuccessor(data);
-  if (succ == nullptr) {
-    throw std::length_error("Successor not found");
+template <typename Data, typename Compare>
+const Data& SetLst<Data, Compare>::Successor(const Data& data) const {
+  if (const Data* succ = TrySuccessor(data)) {
+    return *succ;
   }
 
-  return succ->data;
+  throw std::length_error((size == 0) ? "Empty set" : "Successor not found");
 }
 
-template <typename Data>
-Data SetLst<Data>::SuccessorNRemove(const Data& data) {
+template <typename Data, typename Compare>
+Data SetLst<Data, Compare>::SuccessorNRemove(const Data& data) {
   if (size == 0) {
     throw std::length_error("Empty set");
   }
 
-  typename List<Data>::Node* succ = FindPointerToSuccessor(data);
+  typename List<Data>::Node* succ = FindPointerToSuccessor(ProbeFor(data));
   if (succ == nullptr) {
     throw std::length_error("Successor not found");
   }
 
-  Data value = succ->data;
-
-  if (succ == head) {
-    this->RemoveFromFront();
-  } else {
-    typename List<Data>::Node* current = head;
-    while (current->next != succ) {
-      current = current->next;
-    }
-
-    current->next = succ->next;
-
-    if (succ == List<Data>::tail) {
-      List<Data>::tail = current;
-    }
-
-    delete succ;
-    size--;
-  }
+  Data value = std::move(succ->data);
+  Unlink(succ);
+  this->HashRemoved(value);
 
   return value;
 }
 
-template <typename Data>
-void SetLst<Data>::RemoveSuccessor(const Data& data) {
+template <typename Data, typename Compare>
+void SetLst<Data, Compare>::RemoveSuccessor(const Data& data) {
   if (size == 0) {
     throw std::length_error("Empty set");
   }
 
-  typename List<Data>::Node* succ = FindPointerToSuccessor(data);
+  typename List<Data>::Node* succ = FindPointerToSuccessor(ProbeFor(data));
   if (succ == nullptr) {
     throw std::length_error("Successor not found");
   }
 
-  if (succ == head) {
-    this->RemoveFromFront();
-  } else {
-    typename List<Data>::Node* current = head;
-    while (current->next != succ) {
-      current = current->next;
-    }
+  this->HashRemoved(succ->data);
+  Unlink(succ);
+}
 
-    current->next = succ->next;
+// Non-throwing lookups (inherited from OrderedDictionaryContainer)
 
-    if (succ == List<Data>::tail) {
-      List<Data>::tail = current;
-    }
+template <typename Data, typename Compare>
+const Data* SetLst<Data, Compare>::TryMin() const noexcept {
+  return (head == nullptr) ? nullptr : &head->data;
+}
 
-    delete succ;
-    size--;
-  }
+template <typename Data, typename Compare>
+const Data* SetLst<Data, Compare>::TryMax() const noexcept {
+  return (List<Data>::tail == nullptr) ? nullptr : &List<Data>::tail->data;
+}
+
+template <typename Data, typename Compare>
+const Data* SetLst<Data, Compare>::TryPredecessor(const Data& data) const {
+  typename List<Data>::Node* pred = FindPointerToPredecessor(ProbeFor(data));
+  return (pred == nullptr) ? nullptr : &pred->data;
+}
+
+template <typename Data, typename Compare>
+const Data* SetLst<Data, Compare>::TrySuccessor(const Data& data) const {
+  typename List<Data>::Node* succ = FindPointerToSuccessor(ProbeFor(data));
+  return (succ == nullptr) ? nullptr : &succ->data;
 }
 
 // Specific member functions (inherited from DictionaryContainer)
 
-template <typename Data>
-bool SetLst<Data>::Insert(const Data& data) {
-  // Prima controlla se l'elemento esiste già
-  if (this->Exists(data)) {
-    return false;
+template <typename Data, typename Compare>
+bool SetLst<Data, Compare>::Insert(const Data& data) {
+  if constexpr (std::is_copy_constructible_v<Data>) {
+    return EmplaceUnique(data, data);
+  } else {
+    throw std::logic_error("Copy insertion of a non-copyable type");
   }
+}
 
-  // Se non esiste, inseriscilo mantenendo l'ordinamento
-  InsertInOrder(data);
-  return true;
+template <typename Data, typename Compare>
+bool SetLst<Data, Compare>::Insert(Data&& data) {
+  return EmplaceUnique(data, std::move(data));
 }
 
-template <typename Data>
-bool SetLst<Data>::Insert(Data&& data) {
-  // Prima controlla se l'elemento esiste già
-  if (this->Exists(data)) {
-    return false;
+template <typename Data, typename Compare>
+template <typename... Args>
+bool SetLst<Data, Compare>::Emplace(Args&&... args) {
+  if constexpr (sizeof...(Args) == 1 && (std::is_same_v<std::remove_cvref_t<Args>, Data> && ...)) {
+    return EmplaceUnique(args..., std::forward<Args>(args)...);
+  } else {
+    // Il confronto richiede la chiave: la costruisco sullo stack, il nodo e' allocato solo se serve
+    Data value(std::forward<Args>(args)...);
+    return EmplaceUnique(value, std::move(value));
   }
+}
 
-  // Se non esiste, inseriscilo mantenendo l'ordinamento
-  InsertInOrder(std::move(data));
-  return true;
+template <typename Data, typename Compare>
+bool SetLst<Data, Compare>::Remove(const Data& data) {
+  return RemoveBy(ProbeFor(data));
 }
 
-template <typename Data>
-bool SetLst<Data>::Remove(const Data& data) {
-  if (size == 0) {
-    return false;
-  }
+// Specific member function (inherited from TestableContainer)
 
-  if (head->data == data) {
-    this->RemoveFromFront();
-    return true;
-  }
-  
-  typename List<Data>::Node* current = head;
-  while (current->next != nullptr && current->next->data != data) {
-    current = current->next;
-  }
-  
-  if (current->next == nullptr) {
-    return false;  // Elemento non trovato
-  }
-  
-  typename List<Data>::Node* temp = current->next;
-  current->next = temp->next;
-  
-  if (temp == List<Data>::tail) {
-    List<Data>::tail = current;
-  }
-  
-  delete temp;
-  size--;
-  
-  return true;
+template <typename Data, typename Compare>
+bool SetLst<Data, Compare>::Exists(const Data& data) const noexcept {
+  return (FindPointerTo(ProbeFor(data)) != nullptr);
 }
 
 // Auxiliary member functions
 
-template <typename Data>
-typename List<Data>::Node* SetLst<Data>::FindPointerToMin() const {
+template <typename Data, typename Compare>
+typename List<Data>::Node* SetLst<Data, Compare>::FindPointerToMin() const {
   return head;  // In una lista ordinata, il minimo è in testa
 }
 
-template <typename Data>
-typename List<Data>::Node* SetLst<Data>::FindPointerToMax() const {
+template <typename Data, typename Compare>
+typename List<Data>::Node* SetLst<Data, Compare>::FindPointerToMax() const {
   return List<Data>::tail;  // In una lista ordinata, il massimo è in coda
 }
 
-template <typename Data>
-typename List<Data>::Node* SetLst<Data>::FindPointerToPredecessor(const Data& data) const {
-  if (size == 0 || data <= head->data) {
-    return nullptr;  // Non c'è predecessore
-  }
-  
-  typename List<Data>::Node* current = head;
+template <typename Data, typename Compare>
+template <typename Probe>
+typename List<Data>::Node* SetLst<Data, Compare>::FindPointerToPredecessor(const Probe& probe) const {
+  // Ultimo nodo che precede la chiave
   typename List<Data>::Node* predecessor = nullptr;
-  
-  while (current != nullptr && current->data < data) {
+
+  for (typename List<Data>::Node* current = head; current != nullptr && probe(current->data) < 0; current = current->next) {
     predecessor = current;
-    current = current->next;
   }
-  
+
   return predecessor;
 }
 
-template <typename Data>
-typename List<Data>::Node* SetLst<Data>::FindPointerToSuccessor(const Data& data) const {
-  if (size == 0 || data >= List<Data>::tail->data) {
+template <typename Data, typename Compare>
+template <typename Probe>
+typename List<Data>::Node* SetLst<Data, Compare>::FindPointerToSuccessor(const Probe& probe) const {
+  if (size == 0 || probe(List<Data>::tail->data) <= 0) {
     return nullptr;  // Non c'è successore
   }
-  
+
+  // La coda segue la chiave: la scansione si ferma al più su di essa
   typename List<Data>::Node* current = head;
-  
-  while (current != nullptr && current->data <= data) {
+
+  while (probe(current->data) <= 0) {
     current = current->next;
   }
-  
+
   return current;
 }
 
-template <typename Data>
-typename List<Data>::Node* SetLst<Data>::FindPointerTo(const Data& data) const {
+template <typename Data, typename Compare>
+template <typename Probe>
+typename List<Data>::Node* SetLst<Data, Compare>::FindPointerTo(const Probe& probe) const {
+  for (typename List<Data>::Node* current = head; current != nullptr; current = current->next) {
+    auto order = probe(current->data);
+    if (order >= 0) {
+      return (order == 0) ? current : nullptr;
+    }
+  }
+
+  return nullptr;
+}
+
+template <typename Data, typename Compare>
+template <typename Probe>
+bool SetLst<Data, Compare>::RemoveBy(const Probe& probe) {
+  typename List<Data>::Node* previous = nullptr;
   typename List<Data>::Node* current = head;
-  
-  while (current != nullptr && current->data != data) {
+
+  while (current != nullptr) {
+    auto order = probe(current->data);
+    if (order > 0) {
+      return false;  // Elemento non trovato
+    }
+    if (order == 0) {
+      break;
+    }
+    previous = current;
     current = current->next;
   }
-  
-  return current;
+
+  if (current == nullptr) {
+    return false;
+  }
+
+  if (previous == nullptr) {
+    head = current->next;
+  } else {
+    previous->next = current->next;
+  }
+
+  if (current == List<Data>::tail) {
+    List<Data>::tail = previous;
+  }
+
+  this->HashRemoved(current->data);
+  this->DeleteNode(current);
+  size--;
+
+  return true;
 }
 
 /* ************************************************************************** */
 
-}
\ No newline at end of file
+// Heterogeneous lookup
+
+template <typename Data, typename Compare>
+template <typename Key> requires OrderedKey<Key, Data, Compare>
+bool SetLst<Data, Compare>::Exists(const Key& key) const noexcept {
+  return (FindPointerTo(ProbeFor(key)) != nullptr);
+}
+
+template <typename Data, typename Compare>
+template <typename Key> requires OrderedKey<Key, Data, Compare>
+bool SetLst<Data, Compare>::Remove(const Key& key) {
+  return RemoveBy(ProbeFor(key));
+}
+
+template <typename Data, typename Compare>
+template <typename Key> requires OrderedKey<Key, Data, Compare>
+const Data& SetLst<Data, Compare>::Predecessor(const Key& key) const {
+  if (const Data* pred = TryPredecessor(key)) {
+    return *pred;
+  }
+
+  throw std::length_error((size == 0) ? "Empty set" : "Predecessor not found");
+}
+
+template <typename Data, typename Compare>
+template <typename Key> requires OrderedKey<Key, Data, Compare>
+const Data& SetLst<Data, Compare>::Successor(const Key& key) const {
+  if (const Data* succ = TrySuccessor(key)) {
+    return *succ;
+  }
+
+  throw std::length_error((size == 0) ? "Empty set" : "Successor not found");
+}
+
+template <typename Data, typename Compare>
+template <typename Key> requires OrderedKey<Key, Data, Compare>
+const Data* SetLst<Data, Compare>::TryPredecessor(const Key& key) const {
+  typename List<Data>::Node* pred = FindPointerToPredecessor(ProbeFor(key));
+  return (pred == nullptr) ? nullptr : &pred->data;
+}
+
+template <typename Data, typename Compare>
+template <typename Key> requires OrderedKey<Key, Data, Compare>
+const Data* SetLst<Data, Compare>::TrySuccessor(const Key& key) const {
+  typename List<Data>::Node* succ = FindPointerToSuccessor(ProbeFor(key));
+  return (succ == nullptr) ? nullptr : &succ->data;
+}
+
+template <typename Data, typename Compare>
+bool SetLst<Data, Compare>::ExistsKey(const KeyProbe& probe) const {
+  RequireDefaultKeyOrdering<Compare>();
+  return (FindPointerTo(probe) != nullptr);
+}
+
+template <typename Data, typename Compare>
+bool SetLst<Data, Compare>::RemoveKey(const KeyProbe& probe) {
+  RequireDefaultKeyOrdering<Compare>();
+  return RemoveBy(probe);
+}
+
+template <typename Data, typename Compare>
+const Data* SetLst<Data, Compare>::TryPredecessorKey(const KeyProbe& probe) const {
+  RequireDefaultKeyOrdering<Compare>();
+  typename List<Data>::Node* pred = FindPointerToPredecessor(probe);
+  return (pred == nullptr) ? nullptr : &pred->data;
+}
+
+template <typename Data, typename Compare>
+const Data* SetLst<Data, Compare>::TrySuccessorKey(const KeyProbe& probe) const {
+  RequireDefaultKeyOrdering<Compare>();
+  typename List<Data>::Node* succ = FindPointerToSuccessor(probe);
+  return (succ == nullptr) ? nullptr : &succ->data;
+}
+
+/* ************************************************************************** */
+
+}
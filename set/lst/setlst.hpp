@@ -11,17 +11,29 @@
 namespace lasd {
     /* ************************************************************************** */
 
-    template<typename Data>
+    template<typename Data, typename Compare = ThreeWayCompare>
     class SetLst : virtual public Set<Data>,
                    virtual public List<Data> {
+        static_assert(ThreeWayComparator<Compare, Data>, "SetLst needs a three-way comparator for Data");
+
     protected:
         using Container::size;
         using List<Data>::head;
 
-        // Funzione ausiliaria per mantenere elementi ordinati
-        void InsertInOrder(const Data &);
+        [[no_unique_address]] Compare compare{}; // Ordinamento della lista (un solo confronto a tre vie per nodo)
+
+        // Funzione ausiliaria per mantenere elementi ordinati (false se la chiave e' gia' presente)
+        template <typename... Args>
+        bool EmplaceUnique(const Data &, Args &&...);
+
+        // Stacca e distrugge un nodo qualunque della lista, senza aggiornare la hash
+        void Unlink(typename List<Data>::Node *) noexcept;
 
-        void InsertInOrder(Data &&);
+        // Posizione di un elemento rispetto alla chiave secondo compare (negativa: l'elemento la precede)
+        template <typename Key>
+        auto ProbeFor(const Key &key) const {
+            return [this, &key](const Data &data) { return compare(data, key); };
+        }
 
     public:
         // Default constructor
@@ -30,8 +42,10 @@ namespace lasd {
         /* ************************************************************************ */
 
         // Specific constructors
-        SetLst(const TraversableContainer<Data> &); // A set obtained from a TraversableContainer
-        SetLst(MappableContainer<Data> &&); // A set obtained from a MappableContainer
+        explicit SetLst(std::pmr::memory_resource &); // An empty set allocating from the given resource
+        explicit SetLst(ArenaMode); // An empty set owning its arena (O(1) Clear and destruction for trivially destructible Data)
+        SetLst(const TraversableContainer<Data> &, std::pmr::memory_resource & = NodePool::Default()); // A set obtained from a TraversableContainer
+        SetLst(MappableContainer<Data> &&, std::pmr::memory_resource & = NodePool::Default()); // A set obtained from a MappableContainer
 
         /* ************************************************************************ */
 
@@ -52,7 +66,7 @@ namespace lasd {
         SetLst &operator=(const SetLst &);
 
         // Move assignment
-        SetLst &operator=(SetLst &&) noexcept;
+        SetLst &operator=(SetLst &&);
 
         /* ************************************************************************ */
 
@@ -106,27 +120,156 @@ namespace lasd {
         // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
         void RemoveSuccessor(const Data &) override;
 
+        // Non-throwing lookups (inherited from OrderedDictionaryContainer)
+
+        const Data *TryMin() const noexcept override;
+
+        const Data *TryMax() const noexcept override;
+
+        const Data *TryPredecessor(const Data &) const override;
+
+        const Data *TrySuccessor(const Data &) const override;
+
+        // Heterogeneous lookup, ordered by Compare (hides the OrderedDictionaryContainer templates)
+
+        template <typename Key> requires OrderedKey<Key, Data, Compare>
+        const Data &Predecessor(const Key &) const; // (must throw std::length_error when not found)
+
+        template <typename Key> requires OrderedKey<Key, Data, Compare>
+        const Data &Successor(const Key &) const; // (must throw std::length_error when not found)
+
+        template <typename Key> requires OrderedKey<Key, Data, Compare>
+        const Data *TryPredecessor(const Key &) const;
+
+        template <typename Key> requires OrderedKey<Key, Data, Compare>
+        const Data *TrySuccessor(const Key &) const;
+
         // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
 
         /* ************************************************************************ */
 
         // Specific member functions (inherited from DictionaryContainer)
 
-        bool Insert(const Data &) override; // Override DictionaryContainer member (copy of the value)
+        bool Insert(const Data &) override; // Override DictionaryContainer member (copy of the value; std::logic_error if Data is not copyable)
         bool Insert(Data &&) override; // Override DictionaryContainer member (move of the value)
+
+        template <typename... Args>
+        bool Emplace(Args &&... args); // Element built from the arguments (false if already present)
+
         bool Remove(const Data &) override; // Override DictionaryContainer member
 
+        template <typename Key> requires OrderedKey<Key, Data, Compare>
+        bool Remove(const Key &); // Heterogeneous lookup, ordered by Compare
+
+        using List<Data>::RemoveIf; // Bulk removal by predicate: one walk, one hash update per removed node (order is preserved)
+
+        /* ************************************************************************ */
+
+        // Specific member function (inherited from TestableContainer)
+
+        bool Exists(const Data &) const noexcept override; // Override TestableContainer member
+
+        template <typename Key> requires OrderedKey<Key, Data, Compare>
+        bool Exists(const Key &) const noexcept; // Heterogeneous lookup, ordered by Compare
+
     protected:
         // Auxiliary functions, if necessary!
         typename List<Data>::Node *FindPointerToMin() const;
 
         typename List<Data>::Node *FindPointerToMax() const;
 
-        typename List<Data>::Node *FindPointerToPredecessor(const Data &) const;
+        // Scansioni guidate da una probe (vedi ProbeFor o KeyProbe): una sola chiamata per nodo
+
+        template <typename Probe>
+        typename List<Data>::Node *FindPointerToPredecessor(const Probe &) const;
+
+        template <typename Probe>
+        typename List<Data>::Node *FindPointerToSuccessor(const Probe &) const;
+
+        template <typename Probe>
+        typename List<Data>::Node *FindPointerTo(const Probe &) const;
+
+        template <typename Probe>
+        bool RemoveBy(const Probe &);
+
+        // Heterogeneous lookup through the base interfaces: the probe uses the natural ordering of the key,
+        // so with a custom Compare they throw std::logic_error (the set's own overloads use Compare)
+
+        using typename OrderedDictionaryContainer<Data>::KeyProbe;
+
+        bool ExistsKey(const KeyProbe &) const override;
+
+        bool RemoveKey(const KeyProbe &) override;
+
+        const Data *TryPredecessorKey(const KeyProbe &) const override;
+
+        const Data *TrySuccessorKey(const KeyProbe &) const override;
+    };
+
+    /* ************************************************************************** */
+
+    // Statically dispatched SetLst: calls on a FinalSetLst bind at compile time and inline, and the
+    // accessors redefined here read the size without going through the virtual-base pointer.
+    // It is still a SetLst for generic code.
+
+    template<typename Data, typename Compare = ThreeWayCompare>
+    class FinalSetLst final : public SetLst<Data, Compare> {
+    protected:
+        using Container::size;
+
+    public:
+        // Default constructor
+        FinalSetLst() = default;
+
+        /* ************************************************************************ */
+
+        // Specific constructors
+        FinalSetLst(const TraversableContainer<Data> &container) : SetLst<Data, Compare>(container) {
+        } // A set obtained from a TraversableContainer
+
+        FinalSetLst(MappableContainer<Data> &&container) : SetLst<Data, Compare>(std::move(container)) {
+        } // A set obtained from a MappableContainer
+
+        /* ************************************************************************ */
+
+        // Copy constructor (List is a virtual base: the most derived class initializes it, the source is already ordered)
+        FinalSetLst(const FinalSetLst &other) : List<Data>(other), SetLst<Data, Compare>() {
+        }
+
+        // Move constructor
+        FinalSetLst(FinalSetLst &&other) noexcept : List<Data>(std::move(other)), SetLst<Data, Compare>() {
+        }
+
+        /* ************************************************************************ */
+
+        // Destructor
+        ~FinalSetLst() = default;
+
+        /* ************************************************************************ */
+
+        // Copy assignment
+        FinalSetLst &operator=(const FinalSetLst &other) {
+            SetLst<Data, Compare>::operator=(other);
+            return *this;
+        }
+
+        // Move assignment
+        FinalSetLst &operator=(FinalSetLst &&other) {
+            SetLst<Data, Compare>::operator=(std::move(other));
+            return *this;
+        }
+
+        /* ************************************************************************ */
+
+        // Specific member functions (statically dispatched, same contracts as in SetLst)
 
-        typename List<Data>::Node *FindPointerToSuccessor(const Data &) const;
+        ulong Size() const noexcept {
+            return size;
+        }
 
-        typename List<Data>::Node *FindPointerTo(const Data &) const;
+        bool Empty() const noexcept {
+            return (size == 0);
+        }
     };
 
     /* ************************************************************************** */
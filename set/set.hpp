@@ -3,7 +3,11 @@
 
 /* ************************************************************************** */
 
+#include <concepts>
+#include <stdexcept>
+
 #include "../container/dictionary.hpp"
+#include "../container/linear.hpp"
 #include "../container/traversable.hpp"
 
 /* ************************************************************************** */
@@ -11,10 +15,62 @@
 namespace lasd {
     /* ************************************************************************** */
 
+    // Keys accepted by the heterogeneous lookups of the concrete sets: anything the set comparator
+    // orders against Data (with the default ThreeWayCompare, the HeterogeneousKey types), except
+    // arithmetic keys for arithmetic Data, which convert to Data
+
+    template<typename Key, typename Data, typename Compare>
+    concept OrderedKey = !std::same_as<std::remove_cvref_t<Key>, Data> && !ConvertedArithmeticKey<Key, Data> &&
+                         std::invocable<const Compare &, const Data &, const Key &>;
+
+    // The base interfaces pass heterogeneous keys as probes ordered by ThreeWayCompare: a set with another
+    // comparator cannot honour them (the comparator and the key type never meet), so it refuses them
+
+    template<typename Compare>
+    void RequireDefaultKeyOrdering() {
+        if constexpr (!std::same_as<Compare, ThreeWayCompare>) {
+            throw std::logic_error("Heterogeneous lookup through the base interface of a set with a custom Compare");
+        }
+    }
+
+    /* ************************************************************************** */
+
     template<typename Data>
     class Set : virtual public OrderedDictionaryContainer<Data>,
                 virtual public LinearContainer<Data>,
                 virtual public ClearableContainer {
+    protected:
+        // Content hash (see LinearContainer::Hash): independent of the order, a sum of the mixed element
+        // hashes, so Insert and Remove keep the cached value up to date with one element hash each
+
+        using typename LinearContainer<Data>::Cursor;
+
+        std::size_t ComputeHash() const override {
+            std::size_t hash = 0;
+            Cursor cursor = this->CursorAt(0);
+            for (ulong i = 0; i < this->Size(); i++) {
+                hash += this->ElementHash(this->CursorData(cursor));
+                this->CursorNext(cursor);
+            }
+            return hash;
+        }
+
+        void HashAppended(const Data &data) noexcept override {
+            HashInserted(data);
+        }
+
+        void HashInserted(const Data &data) noexcept override {
+            if (this->hashValid) {
+                this->hashValue += this->ElementHash(data);
+            }
+        }
+
+        void HashRemoved(const Data &data) noexcept override {
+            if (this->hashValid) {
+                this->hashValue -= this->ElementHash(data);
+            }
+        }
+
     public:
         // Destructor
         virtual ~Set() = default;
@@ -3,416 +3,468 @@ namespace lasd {
 /* ************************************************************************** */
 
 // Auxiliary protected functions
-template <typename Data>
-ulong SetVec<Data>::FindIndex(const Data& data) const {
-  // Ricerca binaria per trovare l'indice di un elemento
-  if (size == 0 || Vector<Data>::elements == nullptr) {
-    return size;  // Elemento non trovato
-  }
+template <typename Data, typename Compare>
+template <typename Probe>
+ulong SetVec<Data, Compare>::FindIndex(const Probe& probe) const {
+  ulong index = FindInsertionIndex(probe);
+  return (index < size && probe(this->UncheckedAt(index)) == 0) ? index : size;
+}
 
+template <typename Data, typename Compare>
+template <typename Probe>
+ulong SetVec<Data, Compare>::FindInsertionIndex(const Probe& probe) const {
+  // Ricerca binaria del primo elemento non minore della chiave (un confronto per passo,
+  // accesso senza controllo dei limiti: mid e' sempre in [left, right) con right <= size)
   ulong left = 0;
-  ulong right = size - 1;
+  ulong right = size;
 
-  while (left <= right) {
+  while (left < right) {
     ulong mid = left + (right - left) / 2;
 
-    if (Vector<Data>::elements[mid] == data) {
-      return mid;
-    }
-
-    if (Vector<Data>::elements[mid] < data) {
+    if (probe(this->UncheckedAt(mid)) < 0) {
       left = mid + 1;
     } else {
-      if (mid == 0) {
-        break;
-      }
-      right = mid - 1;
+      right = mid;
     }
   }
 
-  return size;
+  return left;
 }
 
-template <typename Data>
-ulong SetVec<Data>::FindInsertionIndex(const Data& data) const {
-  if (size == 0 || Vector<Data>::elements == nullptr) {
-    return 0;
-  }
-
+template <typename Data, typename Compare>
+template <typename Probe>
+ulong SetVec<Data, Compare>::FindSuccessorIndex(const Probe& probe) const {
+  // Ricerca binaria del primo elemento maggiore della chiave
   ulong left = 0;
-  ulong right = size - 1;
+  ulong right = size;
 
-  while (left <= right) {
+  while (left < right) {
     ulong mid = left + (right - left) / 2;
 
-    if (Vector<Data>::elements[mid] == data) {
-      return mid;
-    }
-
-    if (Vector<Data>::elements[mid] < data) {
+    if (probe(this->UncheckedAt(mid)) <= 0) {
       left = mid + 1;
     } else {
-      if (mid == 0) {
-        break;
-      }
-      right = mid - 1;
+      right = mid;
     }
   }
 
   return left;
 }
 
-template <typename Data>
-void SetVec<Data>::ShiftRight(ulong index) {
-  ulong newSize = size + 1;
-  Data* newElements = new Data[newSize]{};
+template <typename Data, typename Compare>
+template <typename... Args>
+bool SetVec<Data, Compare>::EmplaceUnique(const Data& key, Args&&... args) {
+  // Controlla se l'elemento esiste già, prima di qualunque allocazione
+  ulong index = FindInsertionIndex(ProbeFor(key));
 
-  // Copia gli elementi prima del punto di inserimento
-  for (ulong i = 0; i < index && i < size; i++) {
-    newElements[i] = Vector<Data>::elements[i];
+  if (index < size && compare(Vector<Data>::elements[index], key) == 0) {
+    return false;
   }
 
-  // Copia l'elemento da inserire (shift ->)
-  for (ulong i = index; i < size; i++) {
-    newElements[i + 1] = Vector<Data>::elements[i];
-  }
+  // Se non esiste, lo costruisce direttamente nella sua posizione ordinata
+  Vector<Data>::EmplaceAt(index, std::forward<Args>(args)...);
+  return true;
+}
 
-  // Rimpiazza il vecchio array
-  delete[] Vector<Data>::elements;
-  Vector<Data>::elements = newElements;
-  size = newSize;
+template <typename Data, typename Compare>
+void SetVec<Data, Compare>::RemoveAt(ulong index) {
+  this->HashRemoved(Vector<Data>::elements[index]);
+  ShiftLeft(index);
 }
 
-template <typename Data>
-void SetVec<Data>::ShiftLeft(ulong index) {
-  if (size == 0 || Vector<Data>::elements == nullptr) {
-    return;
-  }
+template <typename Data, typename Compare>
+Data SetVec<Data, Compare>::TakeAt(ulong index) {
+  // L'elemento esce per spostamento: la hash si aggiorna sul valore estratto
+  Data value = std::move(Vector<Data>::elements[index]);
+  ShiftLeft(index);
+  this->HashRemoved(value);
+  return value;
+}
 
-  if (size == 1) {
-    // se c'è solo un elemento, lo rimuoviamo
-    delete[] Vector<Data>::elements;
-    Vector<Data>::elements = nullptr;
-    size = 0;
+template <typename Data, typename Compare>
+void SetVec<Data, Compare>::ShiftLeft(ulong index) {
+  if (size == 0 || Vector<Data>::elements == nullptr) {
     return;
   }
 
-  // Crea un nuovo array di dimensione size - 1
-  ulong newSize = size - 1;
-  Data* newElements = new Data[newSize]{};
-
-  // Copia gli elementi prima del punto di rimozione
-  for (ulong i = 0; i < index && i < size; i++) {
-    newElements[i] = Vector<Data>::elements[i];
-  }
+  // Crea un nuovo array di dimensione size - 1 (vuoto se si rimuove l'unico elemento)
+  Data* newElements = Vector<Data>::Allocate(size - 1, this->resource);
 
-  // Copia gli elementi dopo il punto di rimozione (shift <-)
-  for (ulong i = index + 1; i < size; i++) {
-    newElements[i - 1] = Vector<Data>::elements[i];
-  }
+  // Sposta gli elementi prima e dopo il punto di rimozione (shift <-)
+  std::uninitialized_move_n(Vector<Data>::elements, index, newElements);
+  std::uninitialized_move_n(Vector<Data>::elements + index + 1, size - index - 1, newElements + index);
 
-  delete[] Vector<Data>::elements;
+  Vector<Data>::Release(Vector<Data>::elements, size, size, this->resource);
   Vector<Data>::elements = newElements;
-  size = newSize;
+  size--;
 }
 
 // Specific constructors
 
-template <typename Data>
-SetVec<Data>::SetVec(const TraversableContainer<Data>& container) : Vector<Data>() {
-  // Vettore temporaneo per raccogliere gli elementi
-  std::vector<Data> tempElements;
-
-  container.Traverse([&tempElements](const Data& data) {
-    tempElements.push_back(data);
-  });
+template <typename Data, typename Compare>
+SetVec<Data, Compare>::SetVec(std::pmr::memory_resource& memoryResource) : Vector<Data>(memoryResource) {}
 
+template <typename Data, typename Compare>
+SetVec<Data, Compare>::SetVec(const TraversableContainer<Data>& container, std::pmr::memory_resource& memoryResource)
+  : Vector<Data>(memoryResource) {
   // Inserimento degli elementi uno per uno per garantire l'ordinamento e l'unicità
-  for (const auto& data : tempElements) {
+  container.Traverse([this](const Data& data) {
     Insert(data);
-  }
-}
-
-template <typename Data>
-SetVec<Data>::SetVec(MappableContainer<Data>&& container) : Vector<Data>() {
-  std::vector<Data> tempElements;
-
-  container.Map([&tempElements](Data& data) {
-    tempElements.push_back(std::move(data));
   });
+}
 
-  for (auto& data : tempElements) {
+template <typename Data, typename Compare>
+SetVec<Data, Compare>::SetVec(MappableContainer<Data>&& container, std::pmr::memory_resource& memoryResource)
+  : Vector<Data>(memoryResource) {
+  container.Map([this](Data& data) {
     Insert(std::move(data));
-  }
+  });
 }
 
 // Copy constructor
-template <typename Data>
-SetVec<Data>::SetVec(const SetVec<Data>& other) : Vector<Data>(other) {}
+template <typename Data, typename Compare>
+SetVec<Data, Compare>::SetVec(const SetVec<Data, Compare>& other) : Vector<Data>(other) {}
 
 // Move constructor
-template <typename Data>
-SetVec<Data>::SetVec(SetVec<Data>&& other) noexcept : Vector<Data>(std::move(other)) {}
+template <typename Data, typename Compare>
+SetVec<Data, Compare>::SetVec(SetVec<Data, Compare>&& other) noexcept : Vector<Data>(std::move(other)) {}
 
 // Copy assignment
-template <typename Data>
-SetVec<Data>& SetVec<Data>::operator=(const SetVec<Data>& other) {
+template <typename Data, typename Compare>
+SetVec<Data, Compare>& SetVec<Data, Compare>::operator=(const SetVec<Data, Compare>& other) {
   Vector<Data>::operator=(other);
   return *this;
 }
 
 // Move assignment
-template <typename Data>
-SetVec<Data>& SetVec<Data>::operator=(SetVec<Data>&& other) noexcept {
+template <typename Data, typename Compare>
+SetVec<Data, Compare>& SetVec<Data, Compare>::operator=(SetVec<Data, Compare>&& other) {
   Vector<Data>::operator=(std::move(other));
   return *this;
 }
 
 // Comparison operators
-template <typename Data>
-bool SetVec<Data>::operator==(const SetVec<Data>& other) const noexcept {
+template <typename Data, typename Compare>
+bool SetVec<Data, Compare>::operator==(const SetVec<Data, Compare>& other) const noexcept {
   return Vector<Data>::operator==(other);
 }
 
-template <typename Data>
-inline bool SetVec<Data>::operator!=(const SetVec<Data>& other) const noexcept {
+template <typename Data, typename Compare>
+inline bool SetVec<Data, Compare>::operator!=(const SetVec<Data, Compare>& other) const noexcept {
   return !(*this == other);
 }
 
 // Specific member functions (inherited from OrderedDictionaryContainer)
 
-template <typename Data>
-const Data& SetVec<Data>::Min() const {
-  if (size == 0 || Vector<Data>::elements == nullptr) {
-    throw std::length_error("Empty set");
+template <typename Data, typename Compare>
+const Data& SetVec<Data, Compare>::Min() const {
+  if (const Data* min = TryMin()) {
+    return *min;
   }
 
-  return Vector<Data>::elements[0]; // Min e' il primo elemento in un set ordinato
+  throw std::length_error("Empty set");
 }
 
-template <typename Data>
-Data SetVec<Data>::MinNRemove() {
+template <typename Data, typename Compare>
+Data SetVec<Data, Compare>::MinNRemove() {
   if (size == 0 || Vector<Data>::elements == nullptr) {
     throw std::length_error("Empty set");
   }
 
-  Data min = Vector<Data>::elements[0];
-  ShiftLeft(0);
-
-  return min;
+  return TakeAt(0);
 }
 
-template <typename Data>
-void SetVec<Data>::RemoveMin() {
+template <typename Data, typename Compare>
+void SetVec<Data, Compare>::RemoveMin() {
   if (size == 0 || Vector<Data>::elements == nullptr) {
     throw std::length_error("Empty set");
   }
 
-  ShiftLeft(0);
+  RemoveAt(0);
 }
 
-template <typename Data>
-const Data& SetVec<Data>::Max() const {
-  if (size == 0 || Vector<Data>::elements == nullptr) {
-    throw std::length_error("Empty set");
+template <typename Data, typename Compare>
+const Data& SetVec<Data, Compare>::Max() const {
+  if (const Data* max = TryMax()) {
+    return *max;
   }
 
-  return Vector<Data>::elements[size - 1]; // Max e' l'ultimo elemento in un set ordinato
+  throw std::length_error("Empty set");
 }
 
-template <typename Data>
-Data SetVec<Data>::MaxNRemove() {
+template <typename Data, typename Compare>
+Data SetVec<Data, Compare>::MaxNRemove() {
   if (size == 0 || Vector<Data>::elements == nullptr) {
     throw std::length_error("Empty set");
   }
 
-  Data max = Vector<Data>::elements[size - 1];
-  ShiftLeft(size - 1);
-
-  return max;
+  return TakeAt(size - 1);
 }
 
-template <typename Data>
-void SetVec<Data>::RemoveMax() {
+template <typename Data, typename Compare>
+void SetVec<Data, Compare>::RemoveMax() {
   if (size == 0 || Vector<Data>::elements == nullptr) {
     throw std::length_error("Empty set");
   }
 
-  ShiftLeft(size - 1);
+  RemoveAt(size - 1);
 }
 
-template <typename Data>
-const Data& SetVec<Data>::Predecessor(const Data& data) const {
-  if (size == 0 || Vector<Data>::elements == nullptr) {
-    throw std::length_error("Empty set");
+template <typename Data, typename Compare>
+const Data& SetVec<Data, Compare>::Predecessor(const Data& data) const {
+  if (const Data* pred = TryPredecessor(data)) {
+    return *pred;
   }
 
-  // Trov a l'indice del predecessore (elements[i] < data e elements[i+1] >= data)
-  ulong index = FindInsertionIndex(data);
-
-  if (index == 0) {
-    throw std::length_error("Predecessor not found");
-  }
-
-  return Vector<Data>::elements[index - 1];
+  throw std::length_error((size == 0) ? "Empty set" : "Predecessor not found");
 }
 
-template <typename Data>
-Data SetVec<Data>::PredecessorNRemove(const Data& data) {
+template <typename Data, typename Compare>
+Data SetVec<Data, Compare>::PredecessorNRemove(const Data& data) {
   if (size == 0 || Vector<Data>::elements == nullptr) {
     throw std::length_error("Empty set");
   }
 
   // Trova l'indice del predecessore (elements[i] < data e elements[i+1] >= data)
-  ulong index = FindInsertionIndex(data);
+  ulong index = FindInsertionIndex(ProbeFor(data));
 
   if (index == 0) {
     throw std::length_error("Predecessor not found");
   }
 
-  Data pred = Vector<Data>::elements[index - 1];
-  ShiftLeft(index - 1);
-
-  return pred;
+  return TakeAt(index - 1);
 }
 
-template <typename Data>
-void SetVec<Data>::RemovePredecessor(const Data& data) {
+template <typename Data, typename Compare>
+void SetVec<Data, Compare>::RemovePredecessor(const Data& data) {
   if (size == 0 || Vector<Data>::elements == nullptr) {
     throw std::length_error("Empty set");
   }
 
   // Trova l'indice del predecessore (elements[i] < data e elements[i+1] >= data)
-  ulong index = FindInsertionIndex(data);
+  ulong index = FindInsertionIndex(ProbeFor(data));
 
   if (index == 0) {
     throw std::length_error("Predecessor not found");
   }
 
-  ShiftLeft(index - 1);
+  RemoveAt(index - 1);
+}
+
+template <typename Data, typename Compare>
+const Data& SetVec<Data, Compare>::Successor(const Data& data) const {
+  if (const Data* succ = TrySuccessor(data)) {
+    return *succ;
+  }
+
+  throw std::length_error((size == 0) ? "Empty set" : "Successor not found");
 }
 
-template <typename Data>
-const Data& SetVec<Data>::Successor(const Data& data) const {
+template <typename Data, typename Compare>
+Data SetVec<Data, Compare>::SuccessorNRemove(const Data& data) {
   if (size == 0 || Vector<Data>::elements == nullptr) {
     throw std::length_error("Empty set");
   }
 
   // Trova l'indice del successore (elements[i] > data)
-  ulong index = FindInsertionIndex(data);
+  ulong index = FindSuccessorIndex(ProbeFor(data));
 
-  if (index >= size || Vector<Data>::elements[index] == data) {
-    if (index + 1 >= size) {
-      throw std::length_error("Successor not found");
-    }
-    index++;
+  if (index >= size) {
+    throw std::length_error("Successor not found");
   }
 
-  return Vector<Data>::elements[index];
+  return TakeAt(index);
 }
 
-template <typename Data>
-Data SetVec<Data>::SuccessorNRemove(const Data& data) {
+template <typename Data, typename Compare>
+void SetVec<Data, Compare>::RemoveSuccessor(const Data& data) {
   if (size == 0 || Vector<Data>::elements == nullptr) {
     throw std::length_error("Empty set");
   }
 
   // Trova l'indice del successore (elements[i] > data)
-  ulong index = FindInsertionIndex(data);
+  ulong index = FindSuccessorIndex(ProbeFor(data));
 
-  if (index >= size || Vector<Data>::elements[index] == data) {
-    if (index + 1 >= size) {
-      throw std::length_error("Successor not found");
-    }
-    index++;
+  if (index >= size) {
+    throw std::length_error("Successor not found");
   }
 
-  Data succ = Vector<Data>::elements[index];
-  ShiftLeft(index);
+  RemoveAt(index);
+}
+
+// Non-throwing lookups (inherited from OrderedDictionaryContainer)
 
-  return succ;
+template <typename Data, typename Compare>
+const Data* SetVec<Data, Compare>::TryMin() const noexcept {
+  return (size == 0) ? nullptr : Vector<Data>::elements; // Min e' il primo elemento in un set ordinato
 }
 
-template <typename Data>
-void SetVec<Data>::RemoveSuccessor(const Data& data) {
-  if (size == 0 || Vector<Data>::elements == nullptr) {
-    throw std::length_error("Empty set");
+template <typename Data, typename Compare>
+const Data* SetVec<Data, Compare>::TryMax() const noexcept {
+  return (size == 0) ? nullptr : Vector<Data>::elements + size - 1; // Max e' l'ultimo elemento in un set ordinato
+}
+
+template <typename Data, typename Compare>
+const Data* SetVec<Data, Compare>::TryPredecessor(const Data& data) const {
+  if (size == 0) {
+    return nullptr;
   }
 
-  // Trova l'indice del successore (elements[i] > data)
-  ulong index = FindInsertionIndex(data);
+  // Il predecessore precede l'indice di inserimento (elements[i] < data e elements[i+1] >= data)
+  ulong index = FindInsertionIndex(ProbeFor(data));
+  return (index == 0) ? nullptr : Vector<Data>::elements + index - 1;
+}
 
-  if (index >= size || Vector<Data>::elements[index] == data) {
-    if (index + 1 >= size) {
-      throw std::length_error("Successor not found");
-    }
-    index++;
+template <typename Data, typename Compare>
+const Data* SetVec<Data, Compare>::TrySuccessor(const Data& data) const {
+  if (size == 0) {
+    return nullptr;
   }
 
-  ShiftLeft(index);
+  // Trova l'indice del successore (elements[i] > data)
+  ulong index = FindSuccessorIndex(ProbeFor(data));
+  return (index >= size) ? nullptr : Vector<Data>::elements + index;
 }
 
 // Specific member functions (inherited from DictionaryContainer)
 
-template <typename Data>
-bool SetVec<Data>::Insert(const Data& data) {
-  // Controlla se l'elemento esiste già
-  if (size > 0 && Vector<Data>::elements != nullptr) {
-    ulong index = FindInsertionIndex(data);
+template <typename Data, typename Compare>
+bool SetVec<Data, Compare>::Insert(const Data& data) {
+  if constexpr (std::is_copy_constructible_v<Data>) {
+    return EmplaceUnique(data, data);
+  } else {
+    throw std::logic_error("Copy insertion of a non-copyable type");
+  }
+}
 
-    if (index < size && Vector<Data>::elements[index] == data) {
-      return false;
-    }
+template <typename Data, typename Compare>
+bool SetVec<Data, Compare>::Insert(Data&& data) {
+  return EmplaceUnique(data, std::move(data));
+}
 
-    // Se non esiste, inseriscilo mantenendo l'ordinamento
-    ShiftRight(index);
-    Vector<Data>::elements[index] = data;
+template <typename Data, typename Compare>
+template <typename... Args>
+bool SetVec<Data, Compare>::Emplace(Args&&... args) {
+  if constexpr (sizeof...(Args) == 1 && (std::is_same_v<std::remove_cvref_t<Args>, Data> && ...)) {
+    return EmplaceUnique(args..., std::forward<Args>(args)...);
   } else {
-    Vector<Data>::elements = new Data[1];
-    Vector<Data>::elements[0] = data;
-    size = 1;
+    // La chiave va confrontata prima di toccare l'array: la si costruisce sullo stack
+    Data value(std::forward<Args>(args)...);
+    return EmplaceUnique(value, std::move(value));
   }
+}
+
+template <typename Data, typename Compare>
+bool SetVec<Data, Compare>::Remove(const Data& data) {
+  if (size == 0 || Vector<Data>::elements == nullptr) {
+    return false;
+  }
+
+  ulong index = FindIndex(ProbeFor(data));
 
+  if (index >= size) {
+    return false;
+  }
+  
+  RemoveAt(index);
   return true;
 }
 
-template <typename Data>
-bool SetVec<Data>::Insert(Data&& data) {
-  if (size > 0 && Vector<Data>::elements != nullptr) {
-    ulong index = FindInsertionIndex(data);
+// Specific member function (inherited from TestableContainer)
 
-    if (index < size && Vector<Data>::elements[index] == data) {
-      return false;
-    }
+template <typename Data, typename Compare>
+bool SetVec<Data, Compare>::Exists(const Data& data) const noexcept {
+  return (FindIndex(ProbeFor(data)) < size);
+}
 
-    // Se non esiste, inseriscilo mantenendo l'ordinamento
-    ShiftRight(index);
-    Vector<Data>::elements[index] = std::move(data);
-  } else {
-    Vector<Data>::elements = new Data[1];
-    Vector<Data>::elements[0] = std::move(data);
-    size = 1;
+// Heterogeneous lookup
+
+template <typename Data, typename Compare>
+template <typename Key> requires OrderedKey<Key, Data, Compare>
+bool SetVec<Data, Compare>::Exists(const Key& key) const noexcept {
+  return (FindIndex(ProbeFor(key)) < size);
+}
+
+template <typename Data, typename Compare>
+template <typename Key> requires OrderedKey<Key, Data, Compare>
+bool SetVec<Data, Compare>::Remove(const Key& key) {
+  ulong index = FindIndex(ProbeFor(key));
+
+  if (index >= size) {
+    return false;
   }
 
+  RemoveAt(index);
   return true;
 }
 
-template <typename Data>
-bool SetVec<Data>::Remove(const Data& data) {
-  if (size == 0 || Vector<Data>::elements == nullptr) {
-    return false;
+template <typename Data, typename Compare>
+template <typename Key> requires OrderedKey<Key, Data, Compare>
+const Data& SetVec<Data, Compare>::Predecessor(const Key& key) const {
+  if (const Data* pred = TryPredecessor(key)) {
+    return *pred;
   }
 
-  ulong index = FindIndex(data);
+  throw std::length_error((size == 0) ? "Empty set" : "Predecessor not found");
+}
+
+template <typename Data, typename Compare>
+template <typename Key> requires OrderedKey<Key, Data, Compare>
+const Data& SetVec<Data, Compare>::Successor(const Key& key) const {
+  if (const Data* succ = TrySuccessor(key)) {
+    return *succ;
+  }
+
+  throw std::length_error((size == 0) ? "Empty set" : "Successor not found");
+}
+
+template <typename Data, typename Compare>
+template <typename Key> requires OrderedKey<Key, Data, Compare>
+const Data* SetVec<Data, Compare>::TryPredecessor(const Key& key) const {
+  ulong index = FindInsertionIndex(ProbeFor(key));
+  return (index == 0) ? nullptr : Vector<Data>::elements + index - 1;
+}
+
+template <typename Data, typename Compare>
+template <typename Key> requires OrderedKey<Key, Data, Compare>
+const Data* SetVec<Data, Compare>::TrySuccessor(const Key& key) const {
+  ulong index = FindSuccessorIndex(ProbeFor(key));
+  return (index >= size) ? nullptr : Vector<Data>::elements + index;
+}
+
+template <typename Data, typename Compare>
+bool SetVec<Data, Compare>::ExistsKey(const KeyProbe& probe) const {
+  RequireDefaultKeyOrdering<Compare>();
+  return (FindIndex(probe) < size);
+}
+
+template <typename Data, typename Compare>
+bool SetVec<Data, Compare>::RemoveKey(const KeyProbe& probe) {
+  RequireDefaultKeyOrdering<Compare>();
+  ulong index = FindIndex(probe);
 
   if (index >= size) {
     return false;
   }
-  
-  ShiftLeft(index);
+
+  RemoveAt(index);
   return true;
 }
 
+template <typename Data, typename Compare>
+const Data* SetVec<Data, Compare>::TryPredecessorKey(const KeyProbe& probe) const {
+  RequireDefaultKeyOrdering<Compare>();
+  ulong index = FindInsertionIndex(probe);
+  return (index == 0) ? nullptr : Vector<Data>::elements + index - 1;
+}
+
+template <typename Data, typename Compare>
+const Data* SetVec<Data, Compare>::TrySuccessorKey(const KeyProbe& probe) const {
+  RequireDefaultKeyOrdering<Compare>();
+  ulong index = FindSuccessorIndex(probe);
+  return (index >= size) ? nullptr : Vector<Data>::elements + index;
+}
+
 /* ************************************************************************** */
 
-}
\ No newline at end of file
+}
@@ -11,15 +11,26 @@
 namespace lasd {
     /* ************************************************************************** */
 
-    template<typename Data>
+    template<typename Data, typename Compare = ThreeWayCompare>
     class SetVec : virtual public Set<Data>,
                    virtual public Vector<Data>,
                    virtual public ResizableContainer {
+        static_assert(ThreeWayComparator<Compare, Data>, "SetVec needs a three-way comparator for Data");
+
     protected:
         using Container::size;
 
-        // Utility function to maintain sorted order
-        ulong FindIndex(const Data &) const;
+        [[no_unique_address]] Compare compare{}; // Ordinamento del vettore (un solo confronto a tre vie per passo)
+
+        // Posizione di un elemento rispetto alla chiave secondo compare (negativa: l'elemento la precede)
+        template <typename Key>
+        auto ProbeFor(const Key &key) const {
+            return [this, &key](const Data &data) { return compare(data, key); };
+        }
+
+        // Utility function to maintain sorted order (size when not found)
+        template <typename Probe>
+        ulong FindIndex(const Probe &) const;
 
     public:
         // Default constructor
@@ -28,8 +39,9 @@ namespace lasd {
         /* ************************************************************************ */
 
         // Specific constructors
-        SetVec(const TraversableContainer<Data> &); // A set obtained from a TraversableContainer
-        SetVec(MappableContainer<Data> &&); // A set obtained from a MappableContainer
+        explicit SetVec(std::pmr::memory_resource &); // An empty set allocating from the given resource
+        SetVec(const TraversableContainer<Data> &, std::pmr::memory_resource & = *std::pmr::get_default_resource()); // A set obtained from a TraversableContainer
+        SetVec(MappableContainer<Data> &&, std::pmr::memory_resource & = *std::pmr::get_default_resource()); // A set obtained from a MappableContainer
 
         /* ************************************************************************ */
 
@@ -50,7 +62,7 @@ namespace lasd {
         SetVec &operator=(const SetVec &);
 
         // Move assignment
-        SetVec &operator=(SetVec &&) noexcept;
+        SetVec &operator=(SetVec &&);
 
         /* ************************************************************************ */
 
@@ -104,23 +116,173 @@ namespace lasd {
         // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
         void RemoveSuccessor(const Data &) override;
 
+        // Non-throwing lookups (inherited from OrderedDictionaryContainer)
+
+        const Data *TryMin() const noexcept override;
+
+        const Data *TryMax() const noexcept override;
+
+        const Data *TryPredecessor(const Data &) const override;
+
+        const Data *TrySuccessor(const Data &) const override;
+
+        // Heterogeneous lookup, ordered by Compare (hides the OrderedDictionaryContainer templates)
+
+        template <typename Key> requires OrderedKey<Key, Data, Compare>
+        const Data &Predecessor(const Key &) const; // (must throw std::length_error when not found)
+
+        template <typename Key> requires OrderedKey<Key, Data, Compare>
+        const Data &Successor(const Key &) const; // (must throw std::length_error when not found)
+
+        template <typename Key> requires OrderedKey<Key, Data, Compare>
+        const Data *TryPredecessor(const Key &) const;
+
+        template <typename Key> requires OrderedKey<Key, Data, Compare>
+        const Data *TrySuccessor(const Key &) const;
+
         // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
 
         /* ************************************************************************ */
 
         // Specific member functions (inherited from DictionaryContainer)
 
-        bool Insert(const Data &) override; // Override DictionaryContainer member (copy of the value)
+        bool Insert(const Data &) override; // Override DictionaryContainer member (copy of the value; std::logic_error if Data is not copyable)
         bool Insert(Data &&) override; // Override DictionaryContainer member (move of the value)
+
+        template <typename... Args>
+        bool Emplace(Args &&... args); // Element built from the arguments (false if already present)
+
         bool Remove(const Data &) override; // Override DictionaryContainer member
 
+        template <typename Key> requires OrderedKey<Key, Data, Compare>
+        bool Remove(const Key &); // Heterogeneous lookup, ordered by Compare
+
+        using Vector<Data>::RemoveIf; // Bulk removal by predicate: one stable compaction and a single reallocation instead of a ShiftLeft per element (order is preserved)
+
+        /* ************************************************************************ */
+
+        // Specific member function (inherited from TestableContainer)
+
+        bool Exists(const Data &) const noexcept override; // Override TestableContainer member
+
+        template <typename Key> requires OrderedKey<Key, Data, Compare>
+        bool Exists(const Key &) const noexcept; // Heterogeneous lookup, ordered by Compare
+
     protected:
-        // Auxiliary functions for InsertOrder
-        ulong FindInsertionIndex(const Data &) const;
+        using Vector<Data>::EmplaceAt; // Inserting at an arbitrary index would break order and uniqueness: only EmplaceUnique uses it
+
+        // Auxiliary functions for InsertOrder: binary searches driven by a probe (see ProbeFor or KeyProbe)
+        template <typename Probe>
+        ulong FindInsertionIndex(const Probe &) const; // First index whose element is not before the key
 
-        void ShiftRight(ulong);
+        template <typename Probe>
+        ulong FindSuccessorIndex(const Probe &) const; // First index whose element follows the key
+
+        template <typename... Args>
+        bool EmplaceUnique(const Data &, Args &&...); // Builds the element in its ordered slot unless the key is present
 
         void ShiftLeft(ulong);
+
+        void RemoveAt(ulong); // ShiftLeft updating the cached hash
+
+        Data TakeAt(ulong); // As RemoveAt, moving the element out
+
+        // Heterogeneous lookup through the base interfaces: the probe uses the natural ordering of the key,
+        // so with a custom Compare they throw std::logic_error (the set's own overloads use Compare)
+
+        using typename OrderedDictionaryContainer<Data>::KeyProbe;
+
+        bool ExistsKey(const KeyProbe &) const override;
+
+        bool RemoveKey(const KeyProbe &) override;
+
+        const Data *TryPredecessorKey(const KeyProbe &) const override;
+
+        const Data *TrySuccessorKey(const KeyProbe &) const override;
+    };
+
+    /* ************************************************************************** */
+
+    // Statically dispatched SetVec: calls on a FinalSetVec bind at compile time and inline, and the
+    // accessors redefined here read the size without going through the virtual-base pointer.
+    // It is still a SetVec for generic code.
+
+    template<typename Data, typename Compare = ThreeWayCompare>
+    class FinalSetVec final : public SetVec<Data, Compare> {
+    protected:
+        using Container::size;
+        using Vector<Data>::elements;
+
+    public:
+        // Default constructor
+        FinalSetVec() = default;
+
+        /* ************************************************************************ */
+
+        // Specific constructors
+        FinalSetVec(const TraversableContainer<Data> &container) : SetVec<Data, Compare>(container) {
+        } // A set obtained from a TraversableContainer
+
+        FinalSetVec(MappableContainer<Data> &&container) : SetVec<Data, Compare>(std::move(container)) {
+        } // A set obtained from a MappableContainer
+
+        /* ************************************************************************ */
+
+        // Copy constructor (Vector is a virtual base: the most derived class initializes it, the source is already ordered)
+        FinalSetVec(const FinalSetVec &other) : Vector<Data>(other), SetVec<Data, Compare>() {
+        }
+
+        // Move constructor
+        FinalSetVec(FinalSetVec &&other) noexcept : Vector<Data>(std::move(other)), SetVec<Data, Compare>() {
+        }
+
+        /* ************************************************************************ */
+
+        // Destructor
+        ~FinalSetVec() = default;
+
+        /* ************************************************************************ */
+
+        // Copy assignment
+        FinalSetVec &operator=(const FinalSetVec &other) {
+            SetVec<Data, Compare>::operator=(other);
+            return *this;
+        }
+
+        // Move assignment
+        FinalSetVec &operator=(FinalSetVec &&other) {
+            SetVec<Data, Compare>::operator=(std::move(other));
+            return *this;
+        }
+
+        /* ************************************************************************ */
+
+        // Specific member functions (statically dispatched, same contracts as in SetVec)
+
+        ulong Size() const noexcept {
+            return size;
+        }
+
+        bool Empty() const noexcept {
+            return (size == 0);
+        }
+
+        using SetVec<Data, Compare>::operator[];
+
+        const Data &operator[](ulong index) const override {
+            if (index >= size) {
+                throw std::out_of_range("Index out of range");
+            }
+            return elements[index];
+        }
+
+        const Data *TryMin() const noexcept override {
+            return (size == 0) ? nullptr : elements;
+        }
+
+        const Data *TryMax() const noexcept override {
+            return (size == 0) ? nullptr : elements + size - 1;
+        }
     };
 
     /* ************************************************************************** */
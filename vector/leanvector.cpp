@@ -0,0 +1,256 @@
+namespace lasd {
+
+/* ************************************************************************** */
+
+// La gestione della memoria riusa Vector<Data>::Allocate/Release (stessa politica di allineamento, sempre sull'heap globale)
+
+// Specific constructor with size
+template <typename Data>
+LeanVector<Data>::LeanVector(ulong newSize) {
+  elements = Allocate(newSize);
+  try {
+    std::uninitialized_value_construct_n(elements, newSize);
+  } catch (...) {
+    Release(elements, 0, newSize);
+    elements = nullptr;
+    throw;
+  }
+  size = newSize;
+}
+
+// Specific constructor from TraversableContainer
+template <typename Data>
+LeanVector<Data>::LeanVector(const TraversableContainer<Data>& container) {
+  auto gathered = Vector<Data>::Gather(container.Size(), std::pmr::new_delete_resource(), [&container](auto&& append) {
+    container.Traverse([&append](const Data& data) {
+      append(data);
+    });
+  });
+  elements = gathered.storage;
+  size = gathered.count;
+}
+
+// Specific constructor from MappableContainer
+template <typename Data>
+LeanVector<Data>::LeanVector(MappableContainer<Data>&& container) {
+  auto gathered = Vector<Data>::Gather(container.Size(), std::pmr::new_delete_resource(), [&container](auto&& append) {
+    container.Map([&append](Data& data) {
+      append(std::move(data));
+    });
+  });
+  elements = gathered.storage;
+  size = gathered.count;
+}
+
+// Copy constructor
+template <typename Data>
+LeanVector<Data>::LeanVector(const LeanVector<Data>& other) {
+  elements = Allocate(other.size);
+  try {
+    std::uninitialized_copy_n(other.elements, other.size, elements);
+  } catch (...) {
+    Release(elements, 0, other.size);
+    elements = nullptr;
+    throw;
+  }
+  size = other.size;
+}
+
+// Move constructor
+template <typename Data>
+LeanVector<Data>::LeanVector(LeanVector<Data>&& other) noexcept {
+  Swap(other);
+}
+
+// Destructor
+template <typename Data>
+LeanVector<Data>::~LeanVector() {
+  Release(elements, size, size);
+}
+
+// Copy assignment
+template <typename Data>
+LeanVector<Data>& LeanVector<Data>::operator=(const LeanVector<Data>& other) {
+  if (this != &other) {
+    LeanVector<Data> temp(other);
+    Swap(temp);
+  }
+  return *this;
+}
+
+// Move assignment
+template <typename Data>
+LeanVector<Data>& LeanVector<Data>::operator=(LeanVector<Data>&& other) noexcept {
+  if (this != &other) {
+    Swap(other);
+  }
+  return *this;
+}
+
+// Comparison operators
+template <typename Data>
+bool LeanVector<Data>::operator==(const LeanVector<Data>& other) const noexcept {
+  return (size == other.size) && std::equal(elements, elements + size, other.elements);
+}
+
+template <typename Data>
+bool LeanVector<Data>::operator!=(const LeanVector<Data>& other) const noexcept {
+  return !(*this == other);
+}
+
+/* ************************************************************************** */
+
+// Specific member functions
+
+template <typename Data>
+void LeanVector<Data>::Clear() {
+  Release(elements, size, size);
+  elements = nullptr;
+  size = 0;
+}
+
+template <typename Data>
+void LeanVector<Data>::Resize(ulong newSize) {
+  if (newSize == size) {
+    return;
+  }
+
+  if (newSize == 0) {
+    Clear();
+    return;
+  }
+
+  ulong minSize = (size < newSize) ? size : newSize;
+  Data* newElements = Allocate(newSize);
+
+  // Come in Vector: prima i nuovi elementi, cosi' un'eccezione lascia il vettore invariato
+  if (newSize > size) {
+    if constexpr (std::is_default_constructible_v<Data>) {
+      try {
+        std::uninitialized_value_construct_n(newElements + size, newSize - size);
+      } catch (...) {
+        Release(newElements, 0, newSize);
+        throw;
+      }
+    } else {
+      Release(newElements, 0, newSize);
+      throw std::length_error("Cannot grow a vector of non-default-constructible data");
+    }
+  }
+
+  std::uninitialized_move_n(elements, minSize, newElements);
+
+  Release(elements, size, size);
+  elements = newElements;
+  size = newSize;
+}
+
+template <typename Data>
+Data& LeanVector<Data>::operator[](ulong index) {
+  if (index >= size) {
+    throw std::out_of_range("Index out of range");
+  }
+  return elements[index];
+}
+
+template <typename Data>
+const Data& LeanVector<Data>::operator[](ulong index) const {
+  if (index >= size) {
+    throw std::out_of_range("Index out of range");
+  }
+  return elements[index];
+}
+
+template <typename Data>
+Data& LeanVector<Data>::Front() {
+  if (size == 0) {
+    throw std::length_error("Empty vector");
+  }
+  return elements[0];
+}
+
+template <typename Data>
+const Data& LeanVector<Data>::Front() const {
+  if (size == 0) {
+    throw std::length_error("Empty vector");
+  }
+  return elements[0];
+}
+
+template <typename Data>
+Data& LeanVector<Data>::Back() {
+  if (size == 0) {
+    throw std::length_error("Empty vector");
+  }
+  return elements[size - 1];
+}
+
+template <typename Data>
+const Data& LeanVector<Data>::Back() const {
+  if (size == 0) {
+    throw std::length_error("Empty vector");
+  }
+  return elements[size - 1];
+}
+
+template <typename Data>
+const Data* LeanVector<Data>::TryFront() const noexcept {
+  return (size == 0) ? nullptr : elements;
+}
+
+template <typename Data>
+const Data* LeanVector<Data>::TryBack() const noexcept {
+  return (size == 0) ? nullptr : elements + size - 1;
+}
+
+template <typename Data>
+bool LeanVector<Data>::Exists(const Data& data) const noexcept {
+  return (std::find(elements, elements + size, data) != elements + size);
+}
+
+template <typename Data>
+template <typename Fun> requires std::invocable<Fun&, const Data&>
+void LeanVector<Data>::Traverse(Fun&& fun) const {
+  for (const Data* current = elements, *stop = elements + size; current != stop; ++current) {
+    fun(*current);
+  }
+}
+
+template <typename Data>
+template <typename Accumulator, typename Fun> requires std::is_invocable_r_v<Accumulator, Fun&, const Data&, const Accumulator&>
+Accumulator LeanVector<Data>::Fold(Fun&& fun, Accumulator acc) const {
+  for (const Data* current = elements, *stop = elements + size; current != stop; ++current) {
+    acc = fun(*current, acc);
+  }
+  return acc;
+}
+
+template <typename Data>
+template <typename Fun> requires std::invocable<Fun&, Data&>
+void LeanVector<Data>::Map(Fun&& fun) {
+  for (Data* current = elements, *stop = elements + size; current != stop; ++current) {
+    fun(*current);
+  }
+}
+
+/* ************************************************************************** */
+
+// Interoperability with the container hierarchy
+
+template <typename Data>
+View<Data> LeanVector<Data>::AsView() const {
+  return View<Data>(std::span<const Data>(elements, size));
+}
+
+/* ************************************************************************** */
+
+// Auxiliary functions
+template <typename Data>
+void LeanVector<Data>::Swap(LeanVector<Data>& other) noexcept {
+  std::swap(elements, other.elements);
+  std::swap(size, other.size);
+}
+
+/* ************************************************************************** */
+
+}
@@ -0,0 +1,160 @@
+#ifndef LEANVECTOR_HPP
+#define LEANVECTOR_HPP
+
+/* ************************************************************************** */
+
+#include <concepts>
+#include <span>
+
+#include "vector.hpp"
+#include "../view/view.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Lean vector for large numbers of small vectors (e.g. adjacency rows): no virtual bases, so the
+// object holds only the element pointer and the size (16 bytes on 64-bit targets). It is not a
+// TraversableContainer: it is built from any TraversableContainer or MappableContainer, and
+// AsView() exposes its elements to the constructors and algorithms that expect one.
+template <typename Data>
+class LeanVector {
+
+private:
+
+  // ...
+
+protected:
+
+  Data* elements = nullptr;  // Memoria grezza: sono costruiti solo i primi size elementi
+  ulong size = 0;
+
+public:
+
+  // Default constructor
+  LeanVector() = default;
+
+  /* ************************************************************************ */
+
+  // Specific constructors
+  explicit LeanVector(ulong newSize); // A vector with a given initial dimension
+  LeanVector(const TraversableContainer<Data>& container); // A vector obtained from a TraversableContainer
+  LeanVector(MappableContainer<Data>&& container); // A vector obtained from a MappableContainer
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  LeanVector(const LeanVector& other);
+
+  // Move constructor
+  LeanVector(LeanVector&& other) noexcept;
+
+  /* ************************************************************************ */
+
+  // Destructor
+  ~LeanVector();
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  LeanVector& operator=(const LeanVector& other);
+
+  // Move assignment
+  LeanVector& operator=(LeanVector&& other) noexcept;
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  bool operator==(const LeanVector& other) const noexcept;
+  bool operator!=(const LeanVector& other) const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (same contracts as in Vector)
+
+  ulong Size() const noexcept {
+    return size;
+  }
+
+  bool Empty() const noexcept {
+    return (size == 0);
+  }
+
+  void Clear();
+
+  void Resize(ulong newSize); // (growing needs a default-constructible Data, otherwise std::length_error)
+
+  Data& operator[](ulong index); // (must throw std::out_of_range when out of range)
+  const Data& operator[](ulong index) const; // (must throw std::out_of_range when out of range)
+
+  Data& Front(); // (must throw std::length_error when empty)
+  const Data& Front() const; // (must throw std::length_error when empty)
+
+  Data& Back(); // (must throw std::length_error when empty)
+  const Data& Back() const; // (must throw std::length_error when empty)
+
+  const Data* TryFront() const noexcept;
+  const Data* TryBack() const noexcept;
+
+  bool Exists(const Data& data) const noexcept;
+
+  template <typename Fun> requires std::invocable<Fun&, const Data&>
+  void Traverse(Fun&& fun) const;
+
+  template <typename Accumulator, typename Fun> requires std::is_invocable_r_v<Accumulator, Fun&, const Data&, const Accumulator&>
+  Accumulator Fold(Fun&& fun, Accumulator acc) const;
+
+  template <typename Fun> requires std::invocable<Fun&, Data&>
+  void Map(Fun&& fun);
+
+  /* ************************************************************************ */
+
+  // Interoperability with the container hierarchy
+
+  View<Data> AsView() const; // Lazy view over the elements (must not outlive the vector nor a resize)
+
+  /* ************************************************************************ */
+
+  // Iterators (raw pointers: contiguous storage)
+
+  Data* begin() noexcept {
+    return elements;
+  }
+
+  Data* end() noexcept {
+    return elements + size;
+  }
+
+  const Data* begin() const noexcept {
+    return elements;
+  }
+
+  const Data* end() const noexcept {
+    return elements + size;
+  }
+
+protected:
+
+  // Auxiliary functions, if necessary!
+  void Swap(LeanVector& other) noexcept;
+
+  // Storage on the global heap (no room for a memory resource pointer): Vector's helpers on new_delete_resource
+  static Data* Allocate(ulong count) {
+    return Vector<Data>::Allocate(count, std::pmr::new_delete_resource());
+  }
+
+  static void Release(Data* storage, ulong constructed, ulong capacity) noexcept {
+    Vector<Data>::Release(storage, constructed, capacity, std::pmr::new_delete_resource());
+  }
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "leanvector.cpp"
+
+#endif
@@ -2,63 +2,82 @@ namespace lasd {
 
 /* ************************************************************************** */
 
+// Specific constructor with a memory resource
+template <typename Data>
+Vector<Data>::Vector(std::pmr::memory_resource& memoryResource) noexcept : resource(&memoryResource) {}
+
 // Specific constructor with size
 template <typename Data>
-Vector<Data>::Vector(unsigned long newSize) {
-  elements = new Data[newSize]{};
+Vector<Data>::Vector(unsigned long newSize, std::pmr::memory_resource& memoryResource) : resource(&memoryResource) {
+  elements = Allocate(newSize, resource);
+  try {
+    std::uninitialized_value_construct_n(elements, newSize);
+  } catch (...) {
+    Release(elements, 0, newSize, resource);
+    elements = nullptr;
+    throw;
+  }
   size = newSize;
 }
 
 // Specific constructor from TraversableContainer
 template <typename Data>
-Vector<Data>::Vector(const TraversableContainer<Data>& container) {
-  size = container.Size();
-  elements = new Data[size]{};
-
-  unsigned long index = 0;
-  container.Traverse([this, &index](const Data& data) {
-    elements[index++] = data;
+Vector<Data>::Vector(const TraversableContainer<Data>& container, std::pmr::memory_resource& memoryResource) : resource(&memoryResource) {
+  Gathered gathered = Gather(container.Size(), resource, [&container](auto&& append) {
+    container.Traverse([&append](const Data& data) {
+      append(data);
+    });
   });
+  elements = gathered.storage;
+  size = gathered.count;
 }
 
 // Specific constructor from MappableContainer
 template <typename Data>
-Vector<Data>::Vector(MappableContainer<Data>&& container) {
-  size = container.Size();
-  elements = new Data[size]{};
-
-  unsigned long index = 0;
-  container.Map([this, &index](Data& data) {
-    elements[index++] = std::move(data);
-    return Data{};
+Vector<Data>::Vector(MappableContainer<Data>&& container, std::pmr::memory_resource& memoryResource) : resource(&memoryResource) {
+  Gathered gathered = Gather(container.Size(), resource, [&container](auto&& append) {
+    container.Map([&append](Data& data) {
+      append(std::move(data));
+    });
   });
+  elements = gathered.storage;
+  size = gathered.count;
 }
 
 // Copy constructor
 template <typename Data>
-Vector<Data>::Vector(const Vector<Data>& other) {
-  elements = new Data[other.size]{};
-  std::copy(other.elements, other.elements + other.size, elements);
+Vector<Data>::Vector(const Vector<Data>& other) : Vector(other, *std::pmr::get_default_resource()) {}
+
+template <typename Data>
+Vector<Data>::Vector(const Vector<Data>& other, std::pmr::memory_resource& memoryResource) : resource(&memoryResource) {
+  elements = Allocate(other.size, resource);
+  try {
+    std::uninitialized_copy_n(other.elements, other.size, elements);
+  } catch (...) {
+    Release(elements, 0, other.size, resource);
+    elements = nullptr;
+    throw;
+  }
   size = other.size;
 }
 
 // Move constructor
 template <typename Data>
-Vector<Data>::Vector(Vector<Data>&& other) noexcept {
+Vector<Data>::Vector(Vector<Data>&& other) noexcept : resource(other.resource) {
   Swap(other);
 }
 
 // Destructor
 template <typename Data>
 Vector<Data>::~Vector() {
-  delete[] elements;
+  Release(elements, size, size, resource);
 }
 
 // Copy assignment
 template <typename Data>
 Vector<Data>& Vector<Data>::operator=(const Vector<Data>& other) {
   if (this != &other) {
-    Vector<Data> temp(other);
+    Vector<Data> temp(other, *resource);
     Swap(temp);
   }
   return *this;
@@ -66,9 +85,25 @@ Vector<Data>& Vector<Data>::operator=(const Vector<Data>& other) {
 
 // Move assignment
 template <typename Data>
-Vector<Data>& Vector<Data>::operator=(Vector<Data>&& other) noexcept {
+Vector<Data>& Vector<Data>::operator=(Vector<Data>&& other) {
   if (this != &other) {
-    Swap(other);
+    if (*resource == *other.resource) {
+      Swap(other);
+    } else {
+      // Risorse diverse: gli elementi si spostano nella memoria di questo vettore (come per std::pmr)
+      Data* moved = Allocate(other.size, resource);
+      try {
+        std::uninitialized_move_n(other.elements, other.size, moved);
+      } catch (...) {
+        Release(moved, 0, other.size, resource); // uninitialized_move_n distrugge gia' gli elementi costruiti
+        throw;
+      }
+      Release(elements, size, size, resource);
+      elements = moved;
+      size = other.size;
+      this->InvalidateHash();
+      other.Clear();
+    }
   }
   return *this;
 }
@@ -80,13 +115,7 @@ bool Vector<Data>::operator==(const Vector<Data>& other) const noexcept {
     return false;
   }
 
-  for (unsigned long i = 0; i < size; i++) {
-    if (elements[i] != other.elements[i]) {
-      return false;
-    }
-  }
-
-  return true;
+  return std::equal(elements, elements + size, other.elements);
 }
 
 template <typename Data>
@@ -100,6 +129,7 @@ Data& Vector<Data>::operator[](unsigned long index) {
   if (index >= size) {
     throw std::out_of_range("Index out of range");
   }
+  this->InvalidateHash(); // Il chiamante puo' modificare l'elemento
   return elements[index];
 }
 
@@ -108,6 +138,7 @@ Data& Vector<Data>::Front() {
   if (size == 0) {
     throw std::length_error("Empty vector");
   }
+  this->InvalidateHash();
   return elements[0];
 }
 
@@ -116,6 +147,7 @@ Data& Vector<Data>::Back() {
   if (size == 0) {
     throw std::length_error("Empty vector");
   }
+  this->InvalidateHash();
   return elements[size - 1];
 }
 
@@ -130,20 +162,410 @@ const Data& Vector<Data>::operator[](unsigned long index) const {
 
 template <typename Data>
 const Data& Vector<Data>::Front() const {
-  if (size == 0) {
-    throw std::length_error("Empty vector");
+  if (const Data* front = TryFront()) {
+    return *front;
   }
-  return elements[0];
+  throw std::length_error("Empty vector");
 }
 
 template <typename Data>
 const Data& Vector<Data>::Back() const {
-  if (size == 0) {
-    throw std::length_error("Empty vector");
+  if (const Data* back = TryBack()) {
+    return *back;
   }
+  throw std::length_error("Empty vector");
+}
+
+template <typename Data>
+const Data* Vector<Data>::TryFront() const noexcept {
+  return (size == 0) ? nullptr : elements;
+}
+
+template <typename Data>
+const Data* Vector<Data>::TryBack() const noexcept {
+  return (size == 0) ? nullptr : elements + size - 1;
+}
+
+// Unchecked access
+
+template <typename Data>
+inline Data& Vector<Data>::UncheckedAt(unsigned long index) noexcept {
+  assert(index < size && "Vector::UncheckedAt out of range");
+  this->InvalidateHash();
+  return elements[index];
+}
+
+template <typename Data>
+inline const Data& Vector<Data>::UncheckedAt(unsigned long index) const noexcept {
+  assert(index < size && "Vector::UncheckedAt out of range");
+  return elements[index];
+}
+
+template <typename Data>
+inline Data& Vector<Data>::UncheckedFront() noexcept {
+  assert(size > 0 && "Vector::UncheckedFront on an empty vector");
+  this->InvalidateHash();
+  return elements[0];
+}
+
+template <typename Data>
+inline const Data& Vector<Data>::UncheckedFront() const noexcept {
+  assert(size > 0 && "Vector::UncheckedFront on an empty vector");
+  return elements[0];
+}
+
+template <typename Data>
+inline Data& Vector<Data>::UncheckedBack() noexcept {
+  assert(size > 0 && "Vector::UncheckedBack on an empty vector");
+  this->InvalidateHash();
   return elements[size - 1];
 }
 
+template <typename Data>
+inline const Data& Vector<Data>::UncheckedBack() const noexcept {
+  assert(size > 0 && "Vector::UncheckedBack on an empty vector");
+  return elements[size - 1];
+}
+
+// Specific member functions (inherited from TraversableContainer, PreOrderTraversableContainer and PostOrderTraversableContainer)
+
+// Visite dirette sull'array, senza operator[] virtuale ne' controllo dei limiti per elemento
+template <typename Data>
+void Vector<Data>::Traverse(TraverseFun fun) const {
+  PreOrderTraverse(fun);
+}
+
+template <typename Data>
+void Vector<Data>::PreOrderTraverseRange(unsigned long from, unsigned long to, TraverseFun fun) const {
+  this->CheckRange(from, to);
+  for (const Data* ptr = elements + from, * end = elements + to; ptr != end; ++ptr) {
+    fun(*ptr);
+  }
+}
+
+template <typename Data>
+void Vector<Data>::PostOrderTraverseRange(unsigned long from, unsigned long to, TraverseFun fun) const {
+  this->CheckRange(from, to);
+  for (const Data* ptr = elements + to, * begin = elements + from; ptr != begin; ) {
+    fun(*--ptr);
+  }
+}
+
+template <typename Data>
+void Vector<Data>::PreOrderMapRange(unsigned long from, unsigned long to, MapFun fun) {
+  this->CheckRange(from, to);
+  this->InvalidateHash();
+  for (Data* ptr = elements + from, * end = elements + to; ptr != end; ++ptr) {
+    fun(*ptr);
+  }
+}
+
+template <typename Data>
+void Vector<Data>::PostOrderMapRange(unsigned long from, unsigned long to, MapFun fun) {
+  this->CheckRange(from, to);
+  this->InvalidateHash();
+  for (Data* ptr = elements + to, * begin = elements + from; ptr != begin; ) {
+    fun(*--ptr);
+  }
+}
+
+template <typename Data>
+void Vector<Data>::TraverseChunks(ChunkFun fun) const {
+  if (size > 0) {
+    fun(std::span<const Data>(elements, size));
+  }
+}
+
+template <typename Data>
+void Vector<Data>::PreOrderTraverse(TraverseFun fun) const {
+  for (const Data* ptr = elements, * end = elements + size; ptr != end; ++ptr) {
+    fun(*ptr);
+  }
+}
+
+template <typename Data>
+void Vector<Data>::PostOrderTraverse(TraverseFun fun) const {
+  for (const Data* ptr = elements + size; ptr != elements; ) {
+    fun(*--ptr);
+  }
+}
+
+template <typename Data>
+template <typename Accumulator>
+Accumulator Vector<Data>::Fold(FoldFun<Accumulator> fun, const Accumulator& acc) const {
+  return PreOrderFold(fun, acc);
+}
+
+template <typename Data>
+template <typename Accumulator>
+Accumulator Vector<Data>::PreOrderFold(FoldFun<Accumulator> fun, const Accumulator& acc) const {
+  Accumulator accumulator = acc;
+  for (const Data* ptr = elements, * end = elements + size; ptr != end; ++ptr) {
+    accumulator = fun(*ptr, accumulator);
+  }
+  return accumulator;
+}
+
+template <typename Data>
+template <typename Accumulator>
+Accumulator Vector<Data>::PostOrderFold(FoldFun<Accumulator> fun, const Accumulator& acc) const {
+  Accumulator accumulator = acc;
+  for (const Data* ptr = elements + size; ptr != elements; ) {
+    accumulator = fun(*--ptr, accumulator);
+  }
+  return accumulator;
+}
+
+template <typename Data>
+template <typename Accumulator, typename Fun> requires FoldMoveCallable<Fun, Data, Accumulator>
+Accumulator Vector<Data>::FoldMove(Fun&& fun, Accumulator acc) const {
+  return PreOrderFoldMove<Accumulator>(std::forward<Fun>(fun), std::move(acc));
+}
+
+template <typename Data>
+template <typename Accumulator, typename Fun> requires FoldMoveCallable<Fun, Data, Accumulator>
+Accumulator Vector<Data>::PreOrderFoldMove(Fun&& fun, Accumulator acc) const {
+  for (const Data* ptr = elements, * end = elements + size; ptr != end; ++ptr) {
+    acc = fun(*ptr, std::move(acc));
+  }
+  return acc;
+}
+
+template <typename Data>
+template <typename Accumulator, typename Fun> requires FoldMoveCallable<Fun, Data, Accumulator>
+Accumulator Vector<Data>::PostOrderFoldMove(Fun&& fun, Accumulator acc) const {
+  for (const Data* ptr = elements + size; ptr != elements; ) {
+    acc = fun(*--ptr, std::move(acc));
+  }
+  return acc;
+}
+
+template <typename Data>
+bool Vector<Data>::PreOrderTraverseWhile(TraverseWhileFun fun) const {
+  for (const Data* ptr = elements, * end = elements + size; ptr != end; ++ptr) {
+    if (!fun(*ptr)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename Data>
+bool Vector<Data>::PostOrderTraverseWhile(TraverseWhileFun fun) const {
+  for (const Data* ptr = elements + size; ptr != elements; ) {
+    if (!fun(*--ptr)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Specific member functions (inherited from MappableContainer, PreOrderMappableContainer and PostOrderMappableContainer)
+template <typename Data>
+void Vector<Data>::Map(MapFun fun) {
+  PreOrderMap(fun);
+}
+
+template <typename Data>
+void Vector<Data>::PreOrderMap(MapFun fun) {
+  this->InvalidateHash();
+  for (Data* ptr = elements, * end = elements + size; ptr != end; ++ptr) {
+    fun(*ptr);
+  }
+}
+
+template <typename Data>
+void Vector<Data>::PostOrderMap(MapFun fun) {
+  this->InvalidateHash();
+  for (Data* ptr = elements + size; ptr != elements; ) {
+    fun(*--ptr);
+  }
+}
+
+// Statically dispatched overloads for generic callables
+template <typename Data>
+template <TraverseCallable<Data> Fun>
+void Vector<Data>::Traverse(Fun&& fun) const {
+  PreOrderTraverse(std::forward<Fun>(fun));
+}
+
+template <typename Data>
+template <TraverseCallable<Data> Fun>
+void Vector<Data>::PreOrderTraverse(Fun&& fun) const {
+  for (const Data* ptr = elements, * end = elements + size; ptr != end; ++ptr) {
+    fun(*ptr);
+  }
+}
+
+template <typename Data>
+template <TraverseCallable<Data> Fun>
+void Vector<Data>::PostOrderTraverse(Fun&& fun) const {
+  for (const Data* ptr = elements + size; ptr != elements; ) {
+    fun(*--ptr);
+  }
+}
+
+template <typename Data>
+template <typename Accumulator, typename Fun> requires FoldCallable<Fun, Data, Accumulator>
+Accumulator Vector<Data>::Fold(Fun&& fun, const Accumulator& acc) const {
+  return PreOrderFold<Accumulator>(std::forward<Fun>(fun), acc);
+}
+
+template <typename Data>
+template <typename Accumulator, typename Fun> requires FoldCallable<Fun, Data, Accumulator>
+Accumulator Vector<Data>::PreOrderFold(Fun&& fun, const Accumulator& acc) const {
+  Accumulator accumulator = acc;
+  for (const Data* ptr = elements, * end = elements + size; ptr != end; ++ptr) {
+    accumulator = fun(*ptr, accumulator);
+  }
+  return accumulator;
+}
+
+template <typename Data>
+template <typename Accumulator, typename Fun> requires FoldCallable<Fun, Data, Accumulator>
+Accumulator Vector<Data>::PostOrderFold(Fun&& fun, const Accumulator& acc) const {
+  Accumulator accumulator = acc;
+  for (const Data* ptr = elements + size; ptr != elements; ) {
+    accumulator = fun(*--ptr, accumulator);
+  }
+  return accumulator;
+}
+
+template <typename Data>
+template <MapCallable<Data> Fun>
+void Vector<Data>::Map(Fun&& fun) {
+  PreOrderMap(std::forward<Fun>(fun));
+}
+
+template <typename Data>
+template <MapCallable<Data> Fun>
+void Vector<Data>::PreOrderMap(Fun&& fun) {
+  this->InvalidateHash();
+  for (Data* ptr = elements, * end = elements + size; ptr != end; ++ptr) {
+    fun(*ptr);
+  }
+}
+
+template <typename Data>
+template <MapCallable<Data> Fun>
+void Vector<Data>::PostOrderMap(Fun&& fun) {
+  this->InvalidateHash();
+  for (Data* ptr = elements + size; ptr != elements; ) {
+    fun(*--ptr);
+  }
+}
+
+// Lockstep algorithms (arithmetic specializations)
+template <typename Data>
+template <typename Accumulator, typename Fun> requires (std::is_arithmetic_v<Data> && ZipFoldCallable<Fun, Data, Accumulator>)
+Accumulator Vector<Data>::ZipFold(const Vector<Data>& other, Fun&& fun, const Accumulator& acc) const {
+  if (size != other.size) {
+    throw std::length_error("ZipFold on vectors of different size");
+  }
+
+  const Data* left = elements;
+  const Data* right = other.elements;
+  Accumulator accumulator = acc;
+  for (unsigned long i = 0; i < size; i++) {
+    accumulator = fun(left[i], right[i], accumulator);
+  }
+  return accumulator;
+}
+
+template <typename Data>
+template <ZipMapCallable<Data> Fun> requires std::is_arithmetic_v<Data>
+void Vector<Data>::ZipMap(const Vector<Data>& other, Fun&& fun) {
+  if (size != other.size) {
+    throw std::length_error("ZipMap on vectors of different size");
+  }
+
+  this->InvalidateHash();
+
+  if (&other == this) { // Stesso array: niente restrict
+    for (unsigned long i = 0; i < size; i++) {
+      fun(elements[i], elements[i]);
+    }
+    return;
+  }
+
+  Data* __restrict target = elements;
+  const Data* __restrict source = other.elements;
+  for (unsigned long i = 0; i < size; i++) {
+    fun(target[i], source[i]);
+  }
+}
+
+// Specific member functions
+template <typename Data>
+template <typename... Args>
+Data& Vector<Data>::EmplaceAt(unsigned long index, Args&&... args) {
+  if (index > size) {
+    throw std::out_of_range("Index out of range");
+  }
+
+  Data* newElements = Allocate(size + 1, resource);
+
+  // Il nuovo elemento e' costruito per primo (gli argomenti possono riferirsi al vettore stesso):
+  // se la costruzione fallisce il vettore resta invariato
+  try {
+    std::construct_at(newElements + index, std::forward<Args>(args)...);
+  } catch (...) {
+    Release(newElements, 0, size + 1, resource);
+    throw;
+  }
+
+  // Sposta gli elementi prima e dopo il punto di inserimento
+  std::uninitialized_move_n(elements, index, newElements);
+  std::uninitialized_move_n(elements + index, size - index, newElements + index + 1);
+
+  Release(elements, size, size, resource);
+  elements = newElements;
+  size++;
+
+  // In coda la hash di una sequenza si estende, altrove va ricalcolata (un set la aggiorna comunque)
+  if (index == size - 1) {
+    this->HashAppended(elements[index]);
+  } else {
+    this->HashInserted(elements[index]);
+  }
+
+  return elements[index];
+}
+
+template <typename Data>
+template <RemovePredicate<Data> Fun>
+unsigned long Vector<Data>::RemoveIf(Fun&& fun) {
+  // Compattazione stabile: i superstiti scorrono verso l'inizio, gli scartati restano in coda
+  unsigned long kept = 0;
+  unsigned long index = 0;
+  try {
+    for (; index < size; index++) {
+      if (fun(static_cast<const Data&>(elements[index]))) {
+        this->HashRemoved(elements[index]);
+      } else {
+        if (kept != index) {
+          elements[kept] = std::move(elements[index]);
+        }
+        kept++;
+      }
+    }
+  } catch (...) {
+    // Gli elementi non ancora esaminati restano nel vettore
+    for (; index < size; index++, kept++) {
+      if (kept != index) {
+        elements[kept] = std::move(elements[index]);
+      }
+    }
+    Truncate(kept);
+    throw;
+  }
+
+  // Una sola riallocazione, solo se qualcosa e' stato rimosso: la hash e' gia' aggiornata elemento per elemento
+  unsigned long removed = size - kept;
+  Truncate(kept);
+  return removed;
+}
+
 // Specific member function (inherited from ResizableContainer)
 template <typename Data>
 void Vector<Data>::Resize(unsigned long newSize) {
@@ -156,24 +578,42 @@ void Vector<Data>::Resize(unsigned long newSize) {
     return;
   }
 
-  Data* newElements = new Data[newSize]{};
+  if (newSize < size) {
+    Truncate(newSize);
+    this->InvalidateHash();
+    return;
+  }
+
+  Data* newElements = Allocate(newSize, resource);
 
-  unsigned long minSize = (size < newSize) ? size : newSize;
-  for (unsigned long i = 0; i < minSize; i++) {
-    newElements[i] = std::move(elements[i]);
+  // I nuovi elementi vengono costruiti per primi: se falliscono il vettore resta invariato
+  if constexpr (std::is_default_constructible_v<Data>) {
+    try {
+      std::uninitialized_value_construct_n(newElements + size, newSize - size);
+    } catch (...) {
+      Release(newElements, 0, newSize, resource);
+      throw;
+    }
+  } else {
+    Release(newElements, 0, newSize, resource);
+    throw std::length_error("Cannot grow a vector of non-default-constructible data");
   }
 
-  delete[] elements;
+  std::uninitialized_move_n(elements, size, newElements);
+
+  Release(elements, size, size, resource);
   elements = newElements;
   size = newSize;
+  this->InvalidateHash();
 }
 
 // Specific member function (inherited from ClearableContainer)
 template <typename Data>
 void Vector<Data>::Clear() {
-  delete[] elements;
+  Release(elements, size, size, resource);
   elements = nullptr;
   size = 0;
+  this->InvalidateHash();
 }
 
 // Auxiliary functions
@@ -181,21 +621,106 @@ template <typename Data>
 void Vector<Data>::Swap(Vector<Data>& other) noexcept {
   std::swap(elements, other.elements);
   std::swap(size, other.size);
+  this->InvalidateHash();
+  other.InvalidateHash();
+}
+
+template <typename Data>
+Data* Vector<Data>::Allocate(unsigned long count, std::pmr::memory_resource* memoryResource) {
+  if (count == 0) {
+    return nullptr;
+  }
+  return static_cast<Data*>(memoryResource->allocate(count * sizeof(Data), alignof(Data)));
+}
+
+template <typename Data>
+template <typename Feed>
+typename Vector<Data>::Gathered Vector<Data>::Gather(unsigned long hint, std::pmr::memory_resource* memoryResource, Feed&& feed) {
+  unsigned long capacity = hint;
+  unsigned long count = 0;
+  Data* storage = Allocate(capacity, memoryResource);
+
+  try {
+    feed([&](auto&& value) {
+      if (count == capacity) {
+        unsigned long grown = (capacity == 0) ? 1 : 2 * capacity;
+        storage = Relocate(storage, count, capacity, grown, memoryResource);
+        capacity = grown;
+      }
+      std::construct_at(storage + count, std::forward<decltype(value)>(value));
+      count++;
+    });
+
+    if (count != capacity) { // Lo spazio deve coincidere con la dimensione (Vector non ha capacita' separata)
+      storage = Relocate(storage, count, capacity, count, memoryResource);
+      capacity = count;
+    }
+  } catch (...) {
+    Release(storage, count, capacity, memoryResource);
+    throw;
+  }
+
+  return {storage, count};
+}
+
+template <typename Data>
+void Vector<Data>::Truncate(unsigned long newSize) {
+  if (newSize == size) {
+    return;
+  }
+
+  Data* newElements = nullptr;
+  if (newSize != 0) {
+    newElements = Allocate(newSize, resource);
+    std::uninitialized_move_n(elements, newSize, newElements);
+  }
+
+  Release(elements, size, size, resource);
+  elements = newElements;
+  size = newSize;
+}
+
+// Moves the count elements into a block of newCapacity (copies them if the move may throw, so that a
+// failure leaves the old block intact) and releases the old one
+template <typename Data>
+Data* Vector<Data>::Relocate(Data* storage, unsigned long count, unsigned long capacity, unsigned long newCapacity, std::pmr::memory_resource* memoryResource) {
+  Data* relocated = Allocate(newCapacity, memoryResource);
+  try {
+    if constexpr (std::is_nothrow_move_constructible_v<Data> || !std::is_copy_constructible_v<Data>) {
+      std::uninitialized_move_n(storage, count, relocated);
+    } else {
+      std::uninitialized_copy_n(storage, count, relocated);
+    }
+  } catch (...) {
+    Release(relocated, 0, newCapacity, memoryResource);
+    throw;
+  }
+  Release(storage, count, capacity, memoryResource);
+  return relocated;
+}
+
+template <typename Data>
+void Vector<Data>::Release(Data* storage, unsigned long constructed, unsigned long capacity, std::pmr::memory_resource* memoryResource) noexcept {
+  if (storage != nullptr) {
+    std::destroy_n(storage, constructed);
+    memoryResource->deallocate(storage, capacity * sizeof(Data), alignof(Data));
+  }
 }
 
 /* ************************************************************************** */
 
 // SortableVector implementation
 
-template <typename Data>
-void SortableVector<Data>::Sort() {
+template <typename Data, typename Compare>
+void SortableVector<Data, Compare>::Sort() {
+  this->InvalidateHash();
   if (this->size > 1) {
     QuickSort(0, this->size - 1);
   }
 }
 
-template <typename Data>
-void SortableVector<Data>::QuickSort(unsigned long left, unsigned long right) {
+template <typename Data, typename Compare>
+void SortableVector<Data, Compare>::QuickSort(unsigned long left, unsigned long right) {
   if (left < right) {
     unsigned long pivot = Partition(left, right);
 
@@ -207,13 +732,13 @@ void SortableVector<Data>::QuickSort(unsigned long left, unsigned long right) {
   }
 }
 
-template <typename Data>
-unsigned long SortableVector<Data>::Partition(unsigned long left, unsigned long right) {
+template <typename Data, typename Compare>
+unsigned long SortableVector<Data, Compare>::Partition(unsigned long left, unsigned long right) {
   unsigned long pivot = right;
   unsigned long i = left;
 
   for (unsigned long j = left; j < right; j++) {
-    if (this->elements[j] <= this->elements[pivot]) {
+    if (compare(this->elements[j], this->elements[pivot]) <= 0) {
       Swap(i, j);
       i++;
     }
@@ -223,13 +748,88 @@ unsigned long SortableVector<Data>::Partition(unsigned long left, unsigned long
   return i;
 }
 
-template <typename Data>
-void SortableVector<Data>::Swap(unsigned long i, unsigned long j) {
+template <typename Data, typename Compare>
+void SortableVector<Data, Compare>::Swap(unsigned long i, unsigned long j) {
   if (i != j) {
-    std::swap(this->elements[i], this->elements[j]);
+    std::swap(this->elements[i], this->elements[j]); // Hash gia' invalidato una volta da Sort
+  }
+}
+
+/* ************************************************************************** */
+
+// FinalVector implementation
+
+template <typename Data>
+inline ulong FinalVector<Data>::Size() const noexcept {
+  return size;
+}
+
+template <typename Data>
+inline bool FinalVector<Data>::Empty() const noexcept {
+  return (size == 0);
+}
+
+template <typename Data>
+inline Data& FinalVector<Data>::operator[](unsigned long index) {
+  if (index >= size) {
+    throw std::out_of_range("Index out of range");
+  }
+  this->InvalidateHash();
+  return elements[index];
+}
+
+template <typename Data>
+inline const Data& FinalVector<Data>::operator[](unsigned long index) const {
+  if (index >= size) {
+    throw std::out_of_range("Index out of range");
+  }
+  return elements[index];
+}
+
+template <typename Data>
+inline Data& FinalVector<Data>::Front() {
+  if (size == 0) {
+    throw std::length_error("Empty vector");
+  }
+  this->InvalidateHash();
+  return elements[0];
+}
+
+template <typename Data>
+inline const Data& FinalVector<Data>::Front() const {
+  if (size == 0) {
+    throw std::length_error("Empty vector");
+  }
+  return elements[0];
+}
+
+template <typename Data>
+inline Data& FinalVector<Data>::Back() {
+  if (size == 0) {
+    throw std::length_error("Empty vector");
   }
+  this->InvalidateHash();
+  return elements[size - 1];
+}
+
+template <typename Data>
+inline const Data& FinalVector<Data>::Back() const {
+  if (size == 0) {
+    throw std::length_error("Empty vector");
+  }
+  return elements[size - 1];
+}
+
+template <typename Data>
+inline const Data* FinalVector<Data>::TryFront() const noexcept {
+  return (size == 0) ? nullptr : elements;
+}
+
+template <typename Data>
+inline const Data* FinalVector<Data>::TryBack() const noexcept {
+  return (size == 0) ? nullptr : elements + size - 1;
 }
 
 /* ************************************************************************** */
 
-}
\ No newline at end of file
+}
@@ -3,6 +3,13 @@
 
 /* ************************************************************************** */
 
+#include <cassert>
+#include <cstddef>
+#include <algorithm>
+#include <memory>
+#include <memory_resource>
+#include <new>
+
 #include "../container/linear.hpp"
 
 /* ************************************************************************** */
@@ -11,9 +18,15 @@ namespace lasd {
 
 /* ************************************************************************** */
 
+template <typename Data>
+class LeanVector;
+
 template <typename Data>
 class Vector : virtual public MutableLinearContainer<Data>,
                virtual public ResizableContainer {
+
+  friend class LeanVector<Data>; // Shares the raw storage helpers
+
 private:
 
   // ...
@@ -22,26 +35,41 @@ protected:
 
   using Container::size;
 
-  Data* elements = nullptr;  // Array di elementi
+  Data* elements = nullptr;  // Array di elementi (memoria grezza: sono costruiti solo i primi size)
+
+  std::pmr::memory_resource* resource = std::pmr::get_default_resource(); // Provenienza di elements
 
 public:
 
+  // STL-compatible member types (contiguous random-access iterators)
+  using value_type = Data;
+  using size_type = unsigned long;
+  using difference_type = std::ptrdiff_t;
+  using reference = Data&;
+  using const_reference = const Data&;
+  using iterator = Data*;
+  using const_iterator = const Data*;
+
+  /* ************************************************************************ */
+
   // Default constructor
   Vector() = default;
 
   /* ************************************************************************ */
 
-  // Specific constructors
-  explicit Vector(unsigned long newSize); // A vector with a given initial dimension
-  Vector(const TraversableContainer<Data>& container); // A vector obtained from a TraversableContainer
-  Vector(MappableContainer<Data>&& container); // A vector obtained from a MappableContainer
+  // Specific constructors (the storage comes from the given memory resource, the default one otherwise)
+  explicit Vector(std::pmr::memory_resource& memoryResource) noexcept; // An empty vector allocating from memoryResource
+  explicit Vector(unsigned long newSize, std::pmr::memory_resource& memoryResource = *std::pmr::get_default_resource()); // A vector with a given initial dimension
+  Vector(const TraversableContainer<Data>& container, std::pmr::memory_resource& memoryResource = *std::pmr::get_default_resource()); // A vector obtained from a TraversableContainer
+  Vector(MappableContainer<Data>&& container, std::pmr::memory_resource& memoryResource = *std::pmr::get_default_resource()); // A vector obtained from a MappableContainer
 
   /* ************************************************************************ */
 
-  // Copy constructor
+  // Copy constructor (as for std::pmr containers, the copy uses the default resource unless one is given)
   Vector(const Vector& other);
+  Vector(const Vector& other, std::pmr::memory_resource& memoryResource);
 
-  // Move constructor
+  // Move constructor (takes over the storage together with its resource)
   Vector(Vector&& other) noexcept;
 
   /* ************************************************************************ */
@@ -51,11 +79,12 @@ public:
 
   /* ************************************************************************ */
 
-  // Copy assignment
+  // Copy assignment (the vector keeps its own resource)
   Vector& operator=(const Vector& other);
 
-  // Move assignment
-  Vector& operator=(Vector&& other) noexcept;
+  // Move assignment (steals the storage when the resources are equal, otherwise moves the elements into its own:
+  // that allocates, so unlike the move constructor it is not noexcept, as for std::pmr)
+  Vector& operator=(Vector&& other);
 
   /* ************************************************************************ */
 
@@ -86,11 +115,173 @@ public:
 
   const Data& Back() const override; // Override LinearContainer member (must throw std::length_error when empty)
 
+  const Data* TryFront() const noexcept override; // Override LinearContainer member
+
+  const Data* TryBack() const noexcept override; // Override LinearContainer member
+
+  /* ************************************************************************ */
+
+  // Unchecked access for validated hot loops: no bounds check and no virtual call, only an assert
+  // in debug builds (compile with NDEBUG to remove it); out of range access is undefined behaviour
+
+  Data& UncheckedAt(unsigned long index) noexcept;
+  const Data& UncheckedAt(unsigned long index) const noexcept;
+
+  Data& UncheckedFront() noexcept;
+  const Data& UncheckedFront() const noexcept;
+
+  Data& UncheckedBack() noexcept;
+  const Data& UncheckedBack() const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from TraversableContainer, PreOrderTraversableContainer and PostOrderTraversableContainer)
+
+  using typename TraversableContainer<Data>::TraverseFun;
+  using typename TraversableContainer<Data>::TraverseWhileFun;
+
+  void Traverse(TraverseFun fun) const override; // Override TraversableContainer member
+
+  void PreOrderTraverse(TraverseFun fun) const override; // Override PreOrderTraversableContainer member
+
+  void PostOrderTraverse(TraverseFun fun) const override; // Override PostOrderTraversableContainer member
+
+  bool PreOrderTraverseWhile(TraverseWhileFun fun) const override; // Override PreOrderTraversableContainer member
+
+  bool PostOrderTraverseWhile(TraverseWhileFun fun) const override; // Override PostOrderTraversableContainer member
+
+  void PreOrderTraverseRange(unsigned long from, unsigned long to, TraverseFun fun) const override; // Override LinearContainer member (pointer slice)
+
+  void PostOrderTraverseRange(unsigned long from, unsigned long to, TraverseFun fun) const override; // Override LinearContainer member (pointer slice)
+
+  using typename TraversableContainer<Data>::ChunkFun;
+
+  void TraverseChunks(ChunkFun fun) const override; // Override TraversableContainer member (single span over the array)
+
+  template <typename Accumulator>
+  using FoldFun = typename TraversableContainer<Data>::template FoldFun<Accumulator>;
+
+  template <typename Accumulator>
+  Accumulator Fold(FoldFun<Accumulator> fun, const Accumulator& acc) const;
+
+  template <typename Accumulator>
+  Accumulator PreOrderFold(FoldFun<Accumulator> fun, const Accumulator& acc) const;
+
+  template <typename Accumulator>
+  Accumulator PostOrderFold(FoldFun<Accumulator> fun, const Accumulator& acc) const;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from MappableContainer, PreOrderMappableContainer and PostOrderMappableContainer)
+
+  using typename MappableContainer<Data>::MapFun;
+
+  void Map(MapFun fun) override; // Override MappableContainer member
+
+  void PreOrderMap(MapFun fun) override; // Override PreOrderMappableContainer member
+
+  void PostOrderMap(MapFun fun) override; // Override PostOrderMappableContainer member
+
+  void PreOrderMapRange(unsigned long from, unsigned long to, MapFun fun) override; // Override MutableLinearContainer member (pointer slice)
+
+  void PostOrderMapRange(unsigned long from, unsigned long to, MapFun fun) override; // Override MutableLinearContainer member (pointer slice)
+
+  /* ************************************************************************ */
+
+  // Statically dispatched overloads for generic callables (tight loops on the underlying array)
+
+  using LinearContainer<Data>::Traverse;
+  using LinearContainer<Data>::PreOrderTraverse;
+  using LinearContainer<Data>::PostOrderTraverse;
+  using LinearContainer<Data>::Fold;
+  using LinearContainer<Data>::PreOrderFold;
+  using LinearContainer<Data>::PostOrderFold;
+  using MutableLinearContainer<Data>::Map;
+  using MutableLinearContainer<Data>::PreOrderMap;
+  using MutableLinearContainer<Data>::PostOrderMap;
+
+  template <TraverseCallable<Data> Fun>
+  void Traverse(Fun&& fun) const;
+
+  template <TraverseCallable<Data> Fun>
+  void PreOrderTraverse(Fun&& fun) const;
+
+  template <TraverseCallable<Data> Fun>
+  void PostOrderTraverse(Fun&& fun) const;
+
+  template <typename Accumulator, typename Fun> requires FoldCallable<Fun, Data, Accumulator>
+  Accumulator Fold(Fun&& fun, const Accumulator& acc) const;
+
+  template <typename Accumulator, typename Fun> requires FoldCallable<Fun, Data, Accumulator>
+  Accumulator PreOrderFold(Fun&& fun, const Accumulator& acc) const;
+
+  template <typename Accumulator, typename Fun> requires FoldCallable<Fun, Data, Accumulator>
+  Accumulator PostOrderFold(Fun&& fun, const Accumulator& acc) const;
+
+  template <typename Accumulator, typename Fun> requires FoldMoveCallable<Fun, Data, Accumulator>
+  Accumulator FoldMove(Fun&& fun, Accumulator acc) const;
+
+  template <typename Accumulator, typename Fun> requires FoldMoveCallable<Fun, Data, Accumulator>
+  Accumulator PreOrderFoldMove(Fun&& fun, Accumulator acc) const;
+
+  template <typename Accumulator, typename Fun> requires FoldMoveCallable<Fun, Data, Accumulator>
+  Accumulator PostOrderFoldMove(Fun&& fun, Accumulator acc) const;
+
+  template <MapCallable<Data> Fun>
+  void Map(Fun&& fun);
+
+  template <MapCallable<Data> Fun>
+  void PreOrderMap(Fun&& fun);
+
+  template <MapCallable<Data> Fun>
+  void PostOrderMap(Fun&& fun);
+
+  /* ************************************************************************ */
+
+  // Lockstep algorithms between two arithmetic vectors (plain indexed loops the compiler can vectorize)
+
+  using LinearContainer<Data>::ZipFold;
+  using MutableLinearContainer<Data>::ZipMap;
+
+  template <typename Accumulator, typename Fun> requires (std::is_arithmetic_v<Data> && ZipFoldCallable<Fun, Data, Accumulator>)
+  Accumulator ZipFold(const Vector& other, Fun&& fun, const Accumulator& acc) const;
+
+  template <ZipMapCallable<Data> Fun> requires std::is_arithmetic_v<Data>
+  void ZipMap(const Vector& other, Fun&& fun);
+
+  /* ************************************************************************ */
+
+  // Iterators (invalidated by Resize, Clear and by any insertion or removal in derived sets;
+  // the mutable ones drop the cached hash)
+
+  iterator begin() noexcept { this->InvalidateHash(); return elements; }
+  iterator end() noexcept { this->InvalidateHash(); return elements + size; }
+
+  const_iterator begin() const noexcept { return elements; }
+  const_iterator end() const noexcept { return elements + size; }
+
+  const_iterator cbegin() const noexcept { return elements; }
+  const_iterator cend() const noexcept { return elements + size; }
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  std::pmr::memory_resource* Resource() const noexcept { return resource; } // Memory resource of the storage
+
+  template <typename... Args>
+  Data& EmplaceAt(unsigned long index, Args&&... args); // Inserts at index (0..size) an element built in place (must throw std::out_of_range when out of range)
+
+  // Removes every element satisfying the predicate in one stable pass, with a single reallocation at the end;
+  // returns the number of elements removed (if the predicate throws, only the elements already judged are removed)
+  template <RemovePredicate<Data> Fun>
+  unsigned long RemoveIf(Fun&& fun);
+
   /* ************************************************************************ */
 
   // Specific member function (inherited from ResizableContainer)
 
-  void Resize(unsigned long newSize) override; // Override ResizableContainer member
+  void Resize(unsigned long newSize) override; // Override ResizableContainer member (growing needs a default-constructible Data, otherwise std::length_error)
 
   /* ************************************************************************ */
 
@@ -101,15 +292,51 @@ public:
 protected:
 
   // Auxiliary functions, if necessary!
-  void Swap(Vector& other) noexcept;
+  void Swap(Vector& other) noexcept; // Exchanges the storage (the two resources must be equal)
+
+  // Uninitialized storage: Data needs neither a default constructor nor copy operations unless they are used
+  static Data* Allocate(unsigned long count, std::pmr::memory_resource* memoryResource);
+
+  // Destroys the first constructed elements and returns the capacity elements to the resource
+  static void Release(Data* storage, unsigned long constructed, unsigned long capacity, std::pmr::memory_resource* memoryResource) noexcept;
+
+  // Storage filled by feed, which calls the given append once per element: the Size() of the source is
+  // only a hint (a view over a container modified after its creation, or a filtered one, yields a
+  // different number of elements), so the block grows as needed and is trimmed to the exact count
+  struct Gathered {
+    Data* storage;
+    unsigned long count;
+  };
+
+  template <typename Feed>
+  static Gathered Gather(unsigned long hint, std::pmr::memory_resource* memoryResource, Feed&& feed);
+
+  static Data* Relocate(Data* storage, unsigned long count, unsigned long capacity, unsigned long newCapacity, std::pmr::memory_resource* memoryResource);
+
+  void Truncate(unsigned long newSize); // Keeps the first newSize elements (newSize <= size), without touching the hash
+
+  const Data* ContiguousData() const noexcept override {
+    return elements;
+  }
+
+  // Cursor protocol: the index is always in range, so skip the bounds check of operator[]
+  using typename LinearContainer<Data>::Cursor;
+
+  const Data& CursorData(const Cursor& cursor) const override {
+    return elements[cursor.index];
+  }
+
+  Data& CursorMutableData(const Cursor& cursor) override {
+    return elements[cursor.index];
+  }
 
 };
 
 /* ************************************************************************** */
 
-template <typename Data>
+template <typename Data, typename Compare = ThreeWayCompare>
 class SortableVector : virtual public Vector<Data>,
-                       virtual public SortableLinearContainer<Data> {
+                       virtual public SortableLinearContainer<Data, Compare> {
 
 private:
 
@@ -117,7 +344,7 @@ private:
 
 protected:
 
-  // using Container::???;
+  using SortableLinearContainer<Data, Compare>::compare;
 
   // ...
 
@@ -157,7 +384,7 @@ public:
   }
 
   // Move assignment
-  SortableVector& operator=(SortableVector&& other) noexcept {
+  SortableVector& operator=(SortableVector&& other) {
     Vector<Data>::operator=(std::move(other));
     return *this;
   }
@@ -179,6 +406,87 @@ protected:
 
 /* ************************************************************************** */
 
+// Statically dispatched Vector: the class is final, so calls on a FinalVector bind at compile time,
+// and the accessors redefined here read size and elements at fixed offsets instead of going through
+// the virtual-base pointer, so that they inline completely. It is still a Vector for generic code.
+
+template <typename Data>
+class FinalVector final : public Vector<Data> {
+
+protected:
+
+  using Container::size;
+  using Vector<Data>::elements;
+
+public:
+
+  // Default constructor
+  FinalVector() = default;
+
+  /* ************************************************************************ */
+
+  // Specific constructors
+  explicit FinalVector(unsigned long newSize) : Vector<Data>(newSize) {} // A vector with a given initial dimension
+
+  FinalVector(const TraversableContainer<Data>& container) : Vector<Data>(container) {} // A vector obtained from a TraversableContainer
+
+  FinalVector(MappableContainer<Data>&& container) : Vector<Data>(std::move(container)) {} // A vector obtained from a MappableContainer
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  FinalVector(const FinalVector& other) : Vector<Data>(other) {}
+
+  // Move constructor
+  FinalVector(FinalVector&& other) noexcept : Vector<Data>(std::move(other)) {}
+
+  /* ************************************************************************ */
+
+  // Destructor
+  ~FinalVector() = default;
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  FinalVector& operator=(const FinalVector& other) {
+    Vector<Data>::operator=(other);
+    return *this;
+  }
+
+  // Move assignment
+  FinalVector& operator=(FinalVector&& other) {
+    Vector<Data>::operator=(std::move(other));
+    return *this;
+  }
+
+  /* ************************************************************************ */
+
+  // Specific member functions (statically dispatched, same contracts as in Vector)
+
+  ulong Size() const noexcept;
+
+  bool Empty() const noexcept;
+
+  Data& operator[](unsigned long index) override; // (must throw std::out_of_range when out of range)
+
+  const Data& operator[](unsigned long index) const override; // (must throw std::out_of_range when out of range)
+
+  Data& Front() override; // (must throw std::length_error when empty)
+
+  const Data& Front() const override; // (must throw std::length_error when empty)
+
+  Data& Back() override; // (must throw std::length_error when empty)
+
+  const Data& Back() const override; // (must throw std::length_error when empty)
+
+  const Data* TryFront() const noexcept override;
+
+  const Data* TryBack() const noexcept override;
+
+};
+
+/* ************************************************************************** */
+
 }
 
 #include "vector.cpp"
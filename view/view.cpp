@@ -0,0 +1,134 @@
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Auxiliary constructor
+template <typename Data>
+View<Data>::View(Producer newProducer, ulong newSize) : producer(std::move(newProducer)) {
+  size = newSize;
+}
+
+// Specific constructor
+template <typename Data>
+View<Data>::View(const TraversableContainer<Data>& container) {
+  size = container.Size();
+  const TraversableContainer<Data>* source = &container;
+  producer = [source](const TraverseWhileFun& sink) {
+    return source->TraverseWhile(sink);
+  };
+}
+
+template <typename Data>
+View<Data>::View(std::span<const Data> elements) {
+  size = elements.size();
+  producer = [elements](const TraverseWhileFun& sink) {
+    for (const Data& data : elements) {
+      if (!sink(data)) {
+        return false;
+      }
+    }
+    return true;
+  };
+}
+
+/* ************************************************************************** */
+
+// Specific member functions
+
+template <typename Data>
+View<Data> View<Data>::Filter(FilterFun fun) const {
+  Producer previous = producer;
+  Producer filtered = [previous, fun](const TraverseWhileFun& sink) {
+    return previous([&fun, &sink](const Data& data) {
+      return !fun(data) || sink(data);
+    });
+  };
+
+  // La dimensione di Container non e' virtuale e deve restare esatta anche attraverso le basi:
+  // la si calcola qui con una visita senza copie
+  ulong count = 0;
+  filtered([&count](const Data&) {
+    count++;
+    return true;
+  });
+
+  return View(std::move(filtered), count);
+}
+
+template <typename Data>
+template <typename Fun>
+View<std::remove_cvref_t<std::invoke_result_t<Fun&, const Data&>>> View<Data>::Transform(Fun fun) const {
+  using NewData = std::remove_cvref_t<std::invoke_result_t<Fun&, const Data&>>;
+  using NewSink = typename TraversableContainer<NewData>::TraverseWhileFun;
+
+  Producer previous = producer;
+  typename View<NewData>::Producer transformed = [previous, fun](const NewSink& sink) mutable {
+    return previous([&fun, &sink](const Data& data) {
+      return sink(fun(data));
+    });
+  };
+
+  return View<NewData>(std::move(transformed), size);
+}
+
+template <typename Data>
+View<Data> View<Data>::Take(ulong count) const {
+  Producer previous = producer;
+  Producer taken = [previous, count](const TraverseWhileFun& sink) {
+    if (count == 0) {
+      return true;
+    }
+
+    ulong visited = 0;
+    bool stopped = false;
+    previous([&](const Data& data) {
+      if (!sink(data)) {
+        stopped = true;
+        return false;
+      }
+      return ++visited < count; // Interrompe la sorgente appena raggiunto il limite
+    });
+    return !stopped;
+  };
+
+  return View(std::move(taken), (size < count) ? size : count);
+}
+
+template <typename Data>
+View<Data> View<Data>::Drop(ulong count) const {
+  Producer previous = producer;
+  Producer dropped = [previous, count](const TraverseWhileFun& sink) {
+    ulong skipped = 0;
+    return previous([&](const Data& data) {
+      if (skipped < count) {
+        skipped++;
+        return true;
+      }
+      return sink(data);
+    });
+  };
+
+  return View(std::move(dropped), (size > count) ? size - count : 0);
+}
+
+/* ************************************************************************** */
+
+// Specific member functions (inherited from TraversableContainer)
+
+template <typename Data>
+void View<Data>::Traverse(TraverseFun fun) const {
+  producer([&fun](const Data& data) {
+    fun(data);
+    return true;
+  });
+}
+
+template <typename Data>
+bool View<Data>::TraverseWhile(TraverseWhileFun fun) const {
+  return producer(fun);
+}
+
+/* ************************************************************************** */
+
+}
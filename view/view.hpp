@@ -0,0 +1,115 @@
+#ifndef VIEW_HPP
+#define VIEW_HPP
+
+/* ************************************************************************** */
+
+#include <type_traits>
+
+#include "../container/traversable.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Lazy, non-owning view over a TraversableContainer: stages are composed into a single
+// pipeline and no element is copied until the view is traversed. The source container
+// must outlive the view (and every view derived from it), and a view does not survive a
+// mutation of its source: rebuild it after modifying the container (a view over contiguous
+// storage keeps the old pointer, and the size is the one computed at creation).
+// The size is exact through every interface: Filter counts its elements once when created.
+template <typename Data>
+class View : virtual public TraversableContainer<Data> {
+
+  template <typename> friend class View;
+
+private:
+
+  // ...
+
+protected:
+
+  using Container::size;
+
+  using typename TraversableContainer<Data>::TraverseWhileFun;
+
+  // Pushes the elements into the sink until it returns false; true if the source was exhausted
+  using Producer = std::function<bool(const TraverseWhileFun&)>;
+
+  Producer producer;
+
+  View(Producer newProducer, ulong newSize);
+
+public:
+
+  using FilterFun = std::function<bool(const Data&)>;
+
+  /* ************************************************************************ */
+
+  // Specific constructor
+  explicit View(const TraversableContainer<Data>& container); // A view over all the elements of the container
+
+  explicit View(std::span<const Data> elements); // A view over a contiguous range (e.g. the storage of a LeanVector)
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  View(const View& other) = default;
+
+  // Move constructor
+  View(View&& other) noexcept = default;
+
+  /* ************************************************************************ */
+
+  // Destructor
+  virtual ~View() = default;
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  View& operator=(const View& other) = delete; // Views are rebuilt, not reassigned
+
+  // Move assignment
+  View& operator=(View&& other) noexcept = delete;
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  bool operator==(const View&) const noexcept = delete;
+  bool operator!=(const View&) const noexcept = delete;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (each returns a new view; only Filter visits the elements, to count them)
+
+  View Filter(FilterFun fun) const; // Elements satisfying the predicate (one counting visit, for the size)
+
+  template <typename Fun>
+  View<std::remove_cvref_t<std::invoke_result_t<Fun&, const Data&>>> Transform(Fun fun) const; // Elements mapped through fun
+
+  View Take(ulong count) const; // At most the first count elements
+
+  View Drop(ulong count) const; // All but the first count elements
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from TraversableContainer)
+
+  using TraversableContainer<Data>::Traverse;
+
+  using typename TraversableContainer<Data>::TraverseFun;
+
+  void Traverse(TraverseFun fun) const override; // Override TraversableContainer member
+
+  bool TraverseWhile(TraverseWhileFun fun) const override; // Override TraversableContainer member
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "view.cpp"
+
+#endif
@@ -0,0 +1,561 @@
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <stdexcept>
+#include <chrono>
+#include <functional>
+#include <vector>
+#include <memory_resource>
+#include <random>
+#include <algorithm>
+
+#include "../vector/vector.hpp"
+#include "../list/list.hpp"
+#include "../set/vec/setvec.hpp"
+#include "../set/lst/setlst.hpp"
+
+/* ************************************************************************** */
+
+using namespace std;
+using namespace lasd;
+
+/* ************************************************************************** */
+
+// Benchmark utilities
+
+volatile long benchSink = 0; // Impedisce al compilatore di eliminare i cicli misurati
+
+template <typename Fun>
+double NanosecondsPerElement(ulong elements, ulong repetitions, Fun&& fun) {
+  auto start = chrono::steady_clock::now();
+  for (ulong r = 0; r < repetitions; r++) {
+    fun();
+  }
+  auto stop = chrono::steady_clock::now();
+  double total = chrono::duration<double, nano>(stop - start).count();
+  return total / (static_cast<double>(elements) * static_cast<double>(repetitions));
+}
+
+void PrintBenchResult(const string& name, double nsPerElement) {
+  cout << "  " << left << setw(52) << name << right << fixed << setprecision(3) << setw(10) << nsPerElement << " ns/elem" << endl;
+}
+
+/* ************************************************************************** */
+
+// Per-element cost of the std::function entry points versus the templated callable overloads
+
+template <typename ContainerType>
+void benchCallablePaths(const string& name, const ContainerType& con, ulong repetitions) {
+  cout << endl << "=== " << name << " (" << con.Size() << " elements) ===" << endl;
+
+  const TraversableContainer<int>& base = con;
+  typename TraversableContainer<int>::template FoldFun<long> foldFun = [](const int& x, const long& acc) {
+    return acc + x;
+  };
+
+  PrintBenchResult("Fold via std::function (virtual)", NanosecondsPerElement(con.Size(), repetitions, [&]() {
+    benchSink = benchSink + base.Fold(foldFun, 0L);
+  }));
+
+  PrintBenchResult("Fold via templated callable (concrete type)", NanosecondsPerElement(con.Size(), repetitions, [&]() {
+    benchSink = benchSink + con.template Fold<long>([](const int& x, const long& acc) { return acc + x; }, 0L);
+  }));
+
+  PrintBenchResult("Traverse via std::function (virtual)", NanosecondsPerElement(con.Size(), repetitions, [&]() {
+    long sum = 0;
+    base.Traverse(typename TraversableContainer<int>::TraverseFun([&sum](const int& x) { sum += x; }));
+    benchSink = benchSink + sum;
+  }));
+
+  PrintBenchResult("Traverse via templated callable (concrete type)", NanosecondsPerElement(con.Size(), repetitions, [&]() {
+    long sum = 0;
+    con.Traverse([&sum](const int& x) { sum += x; });
+    benchSink = benchSink + sum;
+  }));
+}
+
+void benchCallables() {
+  const ulong elements = 1000000;
+
+  Vector<int> vec(elements);
+  List<int> lst;
+  for (ulong i = 0; i < elements; i++) {
+    vec[i] = static_cast<int>(i % 1000);
+    lst.InsertAtBack(static_cast<int>(i % 1000));
+  }
+
+  benchCallablePaths("Vector<int> Traverse/Fold", vec, 50);
+  benchCallablePaths("List<int> Traverse/Fold", lst, 20);
+}
+
+/* ************************************************************************** */
+
+// Dot product with ZipFold: arithmetic Vector specialization, generic cursors, List cursors
+
+void benchZipFold() {
+  const ulong elements = 1000000;
+
+  Vector<int> left(elements);
+  Vector<int> right(elements);
+  List<int> lst;
+  for (ulong i = 0; i < elements; i++) {
+    left[i] = static_cast<int>(i % 100);
+    right[i] = static_cast<int>(i % 7);
+    lst.InsertAtBack(static_cast<int>(i % 7));
+  }
+
+  auto dot = [](const int& x, const int& y, const long& acc) { return acc + static_cast<long>(x) * y; };
+  const LinearContainer<int>& baseRight = right;
+
+  cout << endl << "=== ZipFold dot product (" << elements << " elements) ===" << endl;
+
+  PrintBenchResult("Vector x Vector (arithmetic specialization)", NanosecondsPerElement(elements, 50, [&]() {
+    benchSink = benchSink + left.ZipFold(right, dot, 0L);
+  }));
+
+  PrintBenchResult("Vector x LinearContainer (contiguous path)", NanosecondsPerElement(elements, 50, [&]() {
+    benchSink = benchSink + left.ZipFold(baseRight, dot, 0L);
+  }));
+
+  PrintBenchResult("Vector x List (lockstep cursors)", NanosecondsPerElement(elements, 20, [&]() {
+    benchSink = benchSink + left.ZipFold(lst, dot, 0L);
+  }));
+}
+
+/* ************************************************************************** */
+
+// String accumulators: copying Fold versus move-aware FoldMove
+
+template <typename ContainerType>
+void benchStringFold(const string& name, const ContainerType& con, ulong repetitions) {
+  cout << endl << "=== " << name << " (" << con.Size() << " elements) ===" << endl;
+
+  PrintBenchResult("Fold (accumulator copied on every step)", NanosecondsPerElement(con.Size(), repetitions, [&]() {
+    string result = con.template Fold<string>([](const string& x, const string& acc) { return acc + x; }, string());
+    benchSink = benchSink + static_cast<long>(result.size());
+  }));
+
+  PrintBenchResult("FoldMove (accumulator moved through)", NanosecondsPerElement(con.Size(), repetitions, [&]() {
+    string result = con.FoldMove([](const string& x, string&& acc) { acc += x; return std::move(acc); }, string());
+    benchSink = benchSink + static_cast<long>(result.size());
+  }));
+
+  const TraversableContainer<string>& base = con;
+  typename TraversableContainer<string>::template FoldMoveFun<string> appendFun = [](const string& x, string&& acc) {
+    acc += x;
+    return std::move(acc);
+  };
+  PrintBenchResult("FoldMove via std::function (virtual)", NanosecondsPerElement(con.Size(), repetitions, [&]() {
+    string result = base.FoldMove(appendFun, string());
+    benchSink = benchSink + static_cast<long>(result.size());
+  }));
+}
+
+void benchStringFolds() {
+  const ulong elements = 20000;
+
+  Vector<string> vec(elements);
+  List<string> lst;
+  for (ulong i = 0; i < elements; i++) {
+    vec[i] = "line " + to_string(i) + ";";
+    lst.InsertAtBack(vec[i]);
+  }
+
+  benchStringFold("Vector<string> concatenation", vec, 5);
+  benchStringFold("List<string> concatenation", lst, 5);
+}
+
+/* ************************************************************************** */
+
+// Successor walks ending at the maximum: exception-terminated versus nullptr-terminated
+
+template <typename SetType>
+void benchSuccessorWalk(const string& name, const SetType& set, int start, ulong walks) {
+  const OrderedDictionaryContainer<int>& ordered = set;
+  ulong steps = 0;
+  for (const int* current = ordered.TrySuccessor(start - 1); current != nullptr; current = ordered.TrySuccessor(*current)) {
+    steps++;
+  }
+
+  cout << endl << "=== " << name << " (" << walks << " walks of " << steps << " steps) ===" << endl;
+
+  PrintBenchResult("Successor + catch length_error", NanosecondsPerElement(steps, walks, [&]() {
+    long sum = 0;
+    try {
+      for (int current = ordered.Successor(start - 1); ; current = ordered.Successor(current)) {
+        sum += current;
+      }
+    } catch (const length_error&) {
+    }
+    benchSink = benchSink + sum;
+  }));
+
+  PrintBenchResult("TrySuccessor until nullptr", NanosecondsPerElement(steps, walks, [&]() {
+    long sum = 0;
+    for (const int* current = ordered.TrySuccessor(start - 1); current != nullptr; current = ordered.TrySuccessor(*current)) {
+      sum += *current;
+    }
+    benchSink = benchSink + sum;
+  }));
+}
+
+void benchSuccessorWalks() {
+  SetVec<int> setVec;
+  SetLst<int> setLst;
+  for (int i = 0; i < 256; i++) {
+    setVec.Insert(i);
+    setLst.Insert(i);
+  }
+
+  // Scansioni brevi verso il massimo: l'ultima ricerca e' quella che fallisce
+  benchSuccessorWalk("SetVec<int> successor walk", setVec, 248, 200000);
+  benchSuccessorWalk("SetLst<int> successor walk", setLst, 248, 20000);
+}
+
+/* ************************************************************************** */
+
+// Per-call cost of the hot accessors through the polymorphic interface, the concrete type and its
+// final counterpart (noinline: the call site must not see the dynamic type of the object)
+
+template <typename LinearType>
+[[gnu::noinline]] long SumByIndex(const LinearType& con) {
+  long sum = 0;
+  for (ulong i = 0; i < con.Size(); i++) {
+    sum += con[i];
+  }
+  return sum;
+}
+
+template <typename LinearType>
+[[gnu::noinline]] long SumEnds(const LinearType& con, ulong calls) {
+  long sum = 0;
+  for (ulong i = 0; i < calls; i++) {
+    sum += con.Front() + con.Back() + static_cast<long>(con.Size());
+  }
+  return sum;
+}
+
+template <typename SetType>
+[[gnu::noinline]] long CountHits(const SetType& set, ulong probes) {
+  long hits = 0;
+  for (ulong i = 0; i < probes; i++) {
+    hits += set.Exists(static_cast<int>(i));
+  }
+  return hits;
+}
+
+void benchDevirtualization() {
+  const ulong elements = 4096;
+  const ulong calls = 4096;
+
+  FinalVector<int> finalVec(elements);
+  for (ulong i = 0; i < elements; i++) {
+    finalVec[i] = static_cast<int>(i);
+  }
+  Vector<int> vec(finalVec);
+  FinalList<int> finalLst(vec);
+  List<int> lst(vec);
+  FinalSetVec<int> finalSet(vec);
+  SetVec<int> set(vec);
+
+  cout << endl << "=== Devirtualized final types (" << elements << " elements) ===" << endl;
+
+  PrintBenchResult("operator[] via LinearContainer<int>&", NanosecondsPerElement(elements, 2000, [&]() {
+    benchSink = benchSink + SumByIndex<LinearContainer<int>>(vec);
+  }));
+  PrintBenchResult("operator[] via Vector<int>&", NanosecondsPerElement(elements, 2000, [&]() {
+    benchSink = benchSink + SumByIndex(vec);
+  }));
+  PrintBenchResult("operator[] via FinalVector<int>&", NanosecondsPerElement(elements, 2000, [&]() {
+    benchSink = benchSink + SumByIndex(finalVec);
+  }));
+
+  PrintBenchResult("Front+Back+Size via LinearContainer<int>&", NanosecondsPerElement(calls, 2000, [&]() {
+    benchSink = benchSink + SumEnds<LinearContainer<int>>(lst, calls);
+  }));
+  PrintBenchResult("Front+Back+Size via List<int>&", NanosecondsPerElement(calls, 2000, [&]() {
+    benchSink = benchSink + SumEnds(lst, calls);
+  }));
+  PrintBenchResult("Front+Back+Size via FinalList<int>& (hoisted)", NanosecondsPerElement(calls, 2000, [&]() {
+    benchSink = benchSink + SumEnds(finalLst, calls);
+  }));
+
+  PrintBenchResult("Exists via DictionaryContainer<int>&", NanosecondsPerElement(calls, 200, [&]() {
+    benchSink = benchSink + CountHits<DictionaryContainer<int>>(set, calls);
+  }));
+  PrintBenchResult("Exists via SetVec<int>&", NanosecondsPerElement(calls, 200, [&]() {
+    benchSink = benchSink + CountHits(set, calls);
+  }));
+  PrintBenchResult("Exists via FinalSetVec<int>&", NanosecondsPerElement(calls, 200, [&]() {
+    benchSink = benchSink + CountHits(finalSet, calls);
+  }));
+}
+
+/* ************************************************************************** */
+
+// Whole-container hashing: rebuilding the hash by traversal on every request versus the cached
+// Hash, and the incremental update of a set hash across Insert/Remove (per-call cost)
+
+void benchContentHash() {
+  const ulong elements = 4096;
+  const ulong calls = 1000;
+
+  Vector<int> vec(elements);
+  for (ulong i = 0; i < elements; i++) {
+    vec[i] = static_cast<int>(i * 7);
+  }
+  SetVec<int> set(vec);
+
+  cout << endl << "=== Content hash (" << elements << " elements, ns per hash) ===" << endl;
+
+  PrintBenchResult("Vector: rehash by traversal", NanosecondsPerElement(calls, 1, [&]() {
+    for (ulong c = 0; c < calls; c++) {
+      benchSink = benchSink + static_cast<long>(vec.Fold<size_t>([](const int& x, const size_t& acc) {
+        return CombineHash(acc, MixHash(std::hash<int>{}(x)));
+      }, 0));
+    }
+  }));
+  vec.Hash();
+  PrintBenchResult("Vector: cached Hash()", NanosecondsPerElement(calls, 1, [&]() {
+    for (ulong c = 0; c < calls; c++) {
+      benchSink = benchSink + static_cast<long>(vec.Hash());
+    }
+  }));
+  PrintBenchResult("Vector: one write then Hash()", NanosecondsPerElement(calls, 1, [&]() {
+    for (ulong c = 0; c < calls; c++) {
+      vec[c] = static_cast<int>(c);
+      benchSink = benchSink + static_cast<long>(vec.Hash());
+    }
+  }));
+
+  set.Hash();
+  PrintBenchResult("SetVec: Insert + Remove + Hash() (incremental)", NanosecondsPerElement(calls, 1, [&]() {
+    for (ulong c = 0; c < calls; c++) {
+      set.Insert(static_cast<int>(c * 7 + 1));
+      set.Remove(static_cast<int>(c * 7 + 1));
+      benchSink = benchSink + static_cast<long>(set.Hash());
+    }
+  }));
+}
+
+/* ************************************************************************** */
+
+// Dropping the even half of a set: one Remove per victim (a reallocation each on SetVec) versus a
+// single RemoveIf pass, each on a fresh copy prepared outside the timed loop (ns per element of the set)
+
+template <typename SetType>
+void benchRemoveIf(const string& name, const SetType& source, ulong repetitions) {
+  cout << endl << "=== " << name << " (" << source.Size() << " elements) ===" << endl;
+
+  vector<SetType> copies(repetitions, source);
+  ulong next = 0;
+  PrintBenchResult("Remove per victim", NanosecondsPerElement(source.Size(), repetitions, [&]() {
+    SetType& set = copies[next++];
+    for (ulong i = 0; i < source.Size(); i += 2) {
+      set.Remove(static_cast<int>(i));
+    }
+    benchSink = benchSink + static_cast<long>(set.Size());
+  }));
+
+  copies.assign(repetitions, source);
+  next = 0;
+  PrintBenchResult("RemoveIf (single pass)", NanosecondsPerElement(source.Size(), repetitions, [&]() {
+    benchSink = benchSink + static_cast<long>(copies[next++].RemoveIf([](const int& x) { return x % 2 == 0; }));
+  }));
+}
+
+void benchRemoveIfs() {
+  Vector<int> vec(20000);
+  for (ulong i = 0; i < vec.Size(); i++) {
+    vec[i] = static_cast<int>(i);
+  }
+  SetVec<int> setVec(vec);
+  SetLst<int> setLst;
+  for (int i = 0; i < 2000; i++) {
+    setLst.Insert(i);
+  }
+
+  benchRemoveIf("SetVec<int> drop even elements", setVec, 5);
+  benchRemoveIf("SetLst<int> drop even elements", setLst, 5);
+}
+
+// Building and destroying a List and filling a SetVec under the default heap, a monotonic arena
+// (released in one go) and an unsynchronized pool (ns per inserted element)
+
+template <typename Fun>
+void benchResources(const string& name, ulong elements, ulong repetitions, Fun&& run) {
+  cout << endl << "=== " << name << " (" << elements << " elements) ===" << endl;
+
+  PrintBenchResult("default resource (new/delete)", NanosecondsPerElement(elements, repetitions, [&]() {
+    run(*pmr::get_default_resource());
+  }));
+
+  PrintBenchResult("monotonic_buffer_resource", NanosecondsPerElement(elements, repetitions, [&]() {
+    pmr::monotonic_buffer_resource arena;
+    run(arena);
+  }));
+
+  pmr::unsynchronized_pool_resource pool;
+  PrintBenchResult("unsynchronized_pool_resource (reused)", NanosecondsPerElement(elements, repetitions, [&]() {
+    run(pool);
+  }));
+}
+
+void benchMemoryResources() {
+  const ulong elements = 100000;
+  benchResources("List<int> build and destroy", elements, 50, [&](pmr::memory_resource& resource) {
+    List<int> lst(resource);
+    for (ulong i = 0; i < elements; i++) {
+      lst.InsertAtBack(static_cast<int>(i));
+    }
+    benchSink = benchSink + static_cast<long>(lst.Size());
+  });
+
+  const ulong setElements = 4000;
+  benchResources("SetVec<int> random inserts", setElements, 20, [&](pmr::memory_resource& resource) {
+    SetVec<int> set(resource);
+    for (ulong i = 0; i < setElements; i++) {
+      set.Insert(static_cast<int>((i * 7919) % setElements));
+    }
+    benchSink = benchSink + static_cast<long>(set.Size());
+  });
+}
+
+// Queue churn (one InsertAtBack and one RemoveFromFront per step) and SetLst insert/remove churn with
+// nodes from new/delete versus the thread's NodePool, used directly or through NodePool::Default(), the
+// default for List and SetLst, which also routes each free to the owning pool (ns per step)
+
+template <typename Fun>
+void benchNodeSource(const string& name, ulong steps, ulong repetitions, Fun&& run) {
+  cout << endl << "=== " << name << " (" << steps << " steps) ===" << endl;
+
+  PrintBenchResult("new_delete_resource", NanosecondsPerElement(steps, repetitions, [&]() {
+    run(*pmr::new_delete_resource());
+  }));
+
+  PrintBenchResult("NodePool::Local()", NanosecondsPerElement(steps, repetitions, [&]() {
+    run(NodePool::Local());
+  }));
+
+  PrintBenchResult("NodePool::Default() (default)", NanosecondsPerElement(steps, repetitions, [&]() {
+    run(NodePool::Default());
+  }));
+}
+
+void benchNodePool() {
+  const ulong steps = 1000000;
+  benchNodeSource("List<int> queue churn, 64 in flight", steps, 10, [&](pmr::memory_resource& resource) {
+    List<int> queue(resource);
+    for (int i = 0; i < 64; i++) {
+      queue.InsertAtBack(i);
+    }
+    for (ulong i = 0; i < steps; i++) {
+      queue.InsertAtBack(static_cast<int>(i));
+      queue.RemoveFromFront();
+    }
+    benchSink = benchSink + queue.Front();
+  });
+
+  const ulong setSteps = 200000;
+  benchNodeSource("SetLst<int> insert/remove churn, 32 elements", setSteps, 10, [&](pmr::memory_resource& resource) {
+    SetLst<int> set(resource);
+    for (int i = 0; i < 32; i++) {
+      set.Insert(i * 2);
+    }
+    for (ulong i = 0; i < setSteps; i++) {
+      const int value = static_cast<int>((i * 13) % 64) | 1;
+      set.Insert(value);
+      set.Remove(value);
+    }
+    benchSink = benchSink + static_cast<long>(set.Size());
+  });
+
+  cout << "  NodePool::Local(): " << NodePool::Local().SlabCount() << " slabs (" << NodePool::Local().IdleSlabCount() << " idle), "
+       << NodePool::Local().FreeCount() << " free blocks" << endl;
+}
+
+// Cost of Clear on a large List (the latency spike at the end of a batch): nodes from new/delete, from
+// the thread's NodePool (the default) and from the list's own arena (ns per node, the build is not measured)
+
+template <typename Make>
+double ClearNanosecondsPerNode(ulong nodes, ulong repetitions, Make&& make) {
+  double total = 0;
+  for (ulong r = 0; r < repetitions; r++) {
+    List<int> lst = make();
+    for (ulong i = 0; i < nodes; i++) {
+      lst.InsertAtBack(static_cast<int>(i));
+    }
+    auto start = chrono::steady_clock::now();
+    lst.Clear();
+    auto stop = chrono::steady_clock::now();
+    total += chrono::duration<double, nano>(stop - start).count();
+    benchSink = benchSink + static_cast<long>(lst.Size());
+  }
+  return total / (static_cast<double>(nodes) * static_cast<double>(repetitions));
+}
+
+void benchArenaClear() {
+  const ulong nodes = 1000000;
+  cout << endl << "=== List<int> Clear (" << nodes << " nodes) ===" << endl;
+  PrintBenchResult("new_delete_resource", ClearNanosecondsPerNode(nodes, 5, []() { return List<int>(*pmr::new_delete_resource()); }));
+  PrintBenchResult("NodePool::Default() (default)", ClearNanosecondsPerNode(nodes, 5, []() { return List<int>(); }));
+  PrintBenchResult("ArenaMode (region released in one go)", ClearNanosecondsPerNode(nodes, 5, []() { return List<int>(ArenaMode{}); }));
+}
+
+// PreOrderTraverse over a fragmented List before and after Compact(). The fragmentation is built in a
+// private NodePool: the values are spread at random over 256 lists, which are then destroyed in random
+// order, so the free list of each slab hands the nodes of the measured list out in random order (the
+// pool keeps its idle slabs, which would otherwise go back upstream and take the disorder with them).
+
+void benchCompact() {
+  const ulong nodes = 1000000;
+  const ulong scatter = 256;
+  NodePool pool(*pmr::new_delete_resource(), NodePool::NoIdleLimit);
+  List<int> lst(pool);
+  {
+    mt19937 generator(2025);
+    vector<List<int>> scattered;
+    for (ulong j = 0; j < scatter; j++) {
+      scattered.emplace_back(pool);
+    }
+    for (ulong i = 0; i < nodes; i++) {
+      scattered[generator() % scatter].InsertAtBack(static_cast<int>(i));
+    }
+    shuffle(scattered.begin(), scattered.end(), generator);
+    for (List<int>& part : scattered) {
+      part.Clear();
+    }
+  }
+  for (ulong i = 0; i < nodes; i++) {
+    lst.InsertAtBack(static_cast<int>(i));
+  }
+
+  cout << endl << "=== List<int> PreOrderTraverse (" << nodes << " nodes) ===" << endl;
+  auto traverse = [&]() {
+    long sum = 0;
+    lst.PreOrderTraverse([&sum](const int& x) { sum += x; });
+    benchSink = benchSink + sum;
+  };
+  PrintBenchResult("fragmented nodes", NanosecondsPerElement(nodes, 10, traverse));
+  PrintBenchResult("Compact() (one-off)", NanosecondsPerElement(nodes, 1, [&]() { lst.Compact(); }));
+  PrintBenchResult("after Compact()", NanosecondsPerElement(nodes, 10, traverse));
+}
+
+/* ************************************************************************** */
+
+int main() {
+  cout << "LASD Libraries 2025 - Benchmarks" << endl;
+  benchCallables();
+  benchZipFold();
+  benchStringFolds();
+  benchSuccessorWalks();
+  benchDevirtualization();
+  benchContentHash();
+  benchRemoveIfs();
+  benchMemoryResources();
+  benchNodePool();
+  benchArenaClear();
+  benchCompact();
+  return 0;
+}
@@ -4,11 +4,26 @@
 #include <string>
 #include <stdexcept>
 #include <algorithm>
+#include <cctype>
+#include <compare>
 #include <random>
+#include <numeric>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <memory>
+#include <string_view>
+#include <unordered_set>
+#include <memory_resource>
+#include <thread>
+#include <atomic>
+#include <cstdint>
 #include "../vector/vector.hpp"
+#include "../vector/leanvector.hpp"
 #include "../list/list.hpp"
 #include "../set/lst/setlst.hpp"
 #include "../set/vec/setvec.hpp"
+#include "../view/view.hpp"
 
 
 using namespace std;
@@ -1228,6 +1243,1969 @@ void compareSetImplementations() {
 }
 
 
+// Generic short-circuit traversal test - works on every LinearContainer
+template <typename ContainerType>
+void testShortCircuitTraversal(const string& name) {
+    cout << "\n=== " << name << " TraverseWhile / FoldWhile Test ===" << endl;
+    bool allTestsPassed = true;
+
+    Vector<int> source(10);
+    for (unsigned long i = 0; i < source.Size(); i++) {
+        source[i] = static_cast<int>(i) + 1;
+    }
+    ContainerType con(source);
+
+    // PreOrderTraverseWhile must stop at the first element greater than 3
+    unsigned long visited = 0;
+    bool completed = con.PreOrderTraverseWhile([&visited](const int& x) {
+        visited++;
+        return x <= 3;
+    });
+    bool preOrderTest = (!completed && visited == 4);
+    printTestResult("PreOrderTraverseWhile stops early", preOrderTest);
+    cout << "  - Expected visited: 4, Actual visited: " << visited << endl;
+
+    // PostOrderTraverseWhile must stop at the first element smaller than 8
+    visited = 0;
+    completed = con.PostOrderTraverseWhile([&visited](const int& x) {
+        visited++;
+        return x >= 8;
+    });
+    bool postOrderTest = (!completed && visited == 4);
+    printTestResult("PostOrderTraverseWhile stops early", postOrderTest);
+    cout << "  - Expected visited: 4, Actual visited: " << visited << endl;
+
+    // TraverseWhile must report a complete visit
+    visited = 0;
+    completed = con.TraverseWhile([&visited](const int&) {
+        visited++;
+        return true;
+    });
+    bool fullTest = (completed && visited == 10);
+    printTestResult("TraverseWhile full visit", fullTest);
+
+    // FoldWhile: sum while the accumulator stays below 10
+    int partialSum = con.template FoldWhile<int>([](const int& x, int& acc) {
+        acc += x;
+        return acc < 10;
+    }, 0);
+    bool foldTest = (partialSum == 10); // 1+2+3+4
+    printTestResult("FoldWhile (bounded sum)", foldTest);
+    cout << "  - Expected sum: 10, Actual sum: " << partialSum << endl;
+
+    int postSum = con.template PostOrderFoldWhile<int>([](const int& x, int& acc) {
+        acc += x;
+        return acc < 19;
+    }, 0);
+    bool postFoldTest = (postSum == 19); // 10+9
+    printTestResult("PostOrderFoldWhile (bounded sum)", postFoldTest);
+    cout << "  - Expected sum: 19, Actual sum: " << postSum << endl;
+
+    bool existsTest = (con.Exists(1) && con.Exists(10) && !con.Exists(0) && !con.Exists(11));
+    printTestResult("Exists (first, last, missing)", existsTest);
+
+    allTestsPassed &= (preOrderTest && postOrderTest && fullTest && foldTest && postFoldTest && existsTest);
+    cout << "Overall TraverseWhile test result: " << (allTestsPassed ? "SUCCESS" : "FAILURE") << endl;
+}
+
+void testDictionaryBulkRemove() {
+    cout << "\n=== Dictionary Bulk Remove Test ===" << endl;
+    bool allTestsPassed = true;
+
+    List<int> source;
+    for (int i = 1; i <= 5; i++) {
+        source.InsertAtBack(i);
+    }
+
+    SetLst<int> setLst(source);
+    SetVec<int> setVec(source);
+
+    List<int> victims(source);
+    victims.InsertAtBack(6);
+
+    // RemoveAll stops once the set is empty and reports the missing element
+    bool removeAllLst = !setLst.RemoveAll(victims) && setLst.Empty();
+    bool removeAllVec = !setVec.RemoveAll(victims) && setVec.Empty();
+    printTestResult("RemoveAll with an extra element", removeAllLst && removeAllVec);
+
+    SetLst<int> setLst2(source);
+    bool removeAllExact = setLst2.RemoveAll(source) && setLst2.Empty();
+    printTestResult("RemoveAll with exactly the same elements", removeAllExact);
+
+    SetVec<int> setVec2(source);
+    bool removeSome = setVec2.RemoveSome(victims) && setVec2.Empty() && !setVec2.RemoveSome(victims);
+    printTestResult("RemoveSome", removeSome);
+
+    allTestsPassed &= (removeAllLst && removeAllVec && removeAllExact && removeSome);
+    cout << "Overall bulk remove test result: " << (allTestsPassed ? "SUCCESS" : "FAILURE") << endl;
+}
+
+int foldSumInt(const int& x, const int& acc) {
+    return acc + x;
+}
+
+// Generic callable overloads test - the templated and std::function paths must agree
+template <typename ContainerType>
+void testTemplatedCallables(const string& name) {
+    cout << "\n=== " << name << " Templated Callables Test ===" << endl;
+    bool allTestsPassed = true;
+
+    Vector<int> source(6);
+    for (unsigned long i = 0; i < source.Size(); i++) {
+        source[i] = static_cast<int>(i) + 1;
+    }
+    ContainerType con(source);
+    const TraversableContainer<int>& base = con;
+
+    typename TraversableContainer<int>::template FoldFun<string> concatFun = [](const int& x, const string& acc) {
+        return acc + to_string(x);
+    };
+
+    string preTemplated = con.template PreOrderFold<string>([](const int& x, const string& acc) { return acc + to_string(x); }, "");
+    string postTemplated = con.template PostOrderFold<string>([](const int& x, const string& acc) { return acc + to_string(x); }, "");
+    string preVirtual = base.Fold(concatFun, string(""));
+    bool foldTest = (preTemplated == "123456" && postTemplated == "654321" && preVirtual == preTemplated);
+    printTestResult("PreOrderFold / PostOrderFold (templated vs std::function)", foldTest);
+    cout << "  - Templated pre: " << preTemplated << ", post: " << postTemplated << ", virtual: " << preVirtual << endl;
+
+    // Stateful callables are invoked in place, not copied
+    int count = 0;
+    auto counter = [&count](const int&) { count++; };
+    con.Traverse(counter);
+    base.Traverse(counter);
+    bool statefulTest = (count == 12);
+    printTestResult("Stateful callable on both paths", statefulTest);
+
+    // Plain function pointers select the templated overload as well
+    int sum = con.template Fold<int>(&foldSumInt, 0);
+    bool pointerTest = (sum == 21);
+    printTestResult("Function pointer Fold", pointerTest);
+
+    con.Map([](int& x) { x *= 10; });
+    con.PostOrderMap([](int& x) { x += 1; });
+    string mapped = con.template Fold<string>([](const int& x, const string& acc) { return acc + to_string(x) + " "; }, "");
+    bool mapTest = (mapped == "11 21 31 41 51 61 ");
+    printTestResult("Map / PostOrderMap with lambdas", mapTest);
+    cout << "  - Expected: 11 21 31 41 51 61, Actual: " << mapped << endl;
+
+    allTestsPassed &= (foldTest && statefulTest && pointerTest && mapTest);
+    cout << "Overall templated callables test result: " << (allTestsPassed ? "SUCCESS" : "FAILURE") << endl;
+}
+
+// Iterators test - standard algorithms and range-for on every container
+static_assert(std::contiguous_iterator<Vector<int>::iterator>);
+static_assert(std::contiguous_iterator<SetVec<int>::const_iterator>);
+static_assert(std::forward_iterator<List<int>::iterator>);
+static_assert(std::forward_iterator<SetLst<int>::const_iterator>);
+static_assert(std::ranges::contiguous_range<SortableVector<int>>);
+static_assert(std::ranges::forward_range<const SetLst<int>>);
+
+void testIterators() {
+    cout << "\n=== Iterators Test ===" << endl;
+    bool allTestsPassed = true;
+
+    SortableVector<int> vec(6);
+    int values[] = {5, 3, 6, 1, 4, 2};
+    std::copy(std::begin(values), std::end(values), vec.begin());
+
+    std::sort(vec.begin(), vec.end());
+    bool sortTest = std::is_sorted(vec.cbegin(), vec.cend()) && vec[0] == 1 && vec[5] == 6;
+    printTestResult("std::sort on SortableVector iterators", sortTest);
+
+    int sum = std::accumulate(vec.cbegin(), vec.cend(), 0);
+    bool accumulateTest = (sum == 21);
+    printTestResult("std::accumulate on Vector", accumulateTest);
+    cout << "  - Expected sum: 21, Actual sum: " << sum << endl;
+
+    List<int> list(vec);
+    for (int& x : list) {
+        x *= 2;
+    }
+    bool rangeForTest = (list.Front() == 2 && list.Back() == 12);
+    printTestResult("Mutable range-for on List", rangeForTest);
+
+    List<int>::const_iterator found = std::find(list.cbegin(), list.cend(), 8);
+    bool findTest = (found != list.cend() && *found == 8 && std::distance(list.cbegin(), found) == 3);
+    printTestResult("std::find on List", findTest);
+
+    SetLst<int> setLst(list);
+    SetVec<int> setVec(list);
+    bool equalTest = std::ranges::equal(setLst, setVec) && std::ranges::equal(setLst, list);
+    printTestResult("std::ranges::equal between SetLst, SetVec and List", equalTest);
+
+    const SetVec<int>& constSet = setVec;
+    auto bound = std::lower_bound(constSet.begin(), constSet.end(), 7);
+    bool boundTest = (bound != constSet.end() && *bound == 8);
+    printTestResult("std::lower_bound on SetVec", boundTest);
+
+    List<int> empty;
+    bool emptyTest = (empty.begin() == empty.end() && std::ranges::distance(empty) == 0);
+    printTestResult("Empty range", emptyTest);
+
+    allTestsPassed &= (sortTest && accumulateTest && rangeForTest && findTest && equalTest && boundTest && emptyTest);
+    cout << "Overall iterators test result: " << (allTestsPassed ? "SUCCESS" : "FAILURE") << endl;
+}
+
+void testContiguousEquality() {
+    cout << "\n=== Contiguous Equality and Traversal Test ===" << endl;
+    bool allTestsPassed = true;
+
+    Vector<int> vec(5);
+    for (unsigned long i = 0; i < vec.Size(); i++) {
+        vec[i] = static_cast<int>(i) * 2;
+    }
+    SortableVector<int> sortable(vec);
+    SetVec<int> setVec(vec);
+    List<int> list(vec);
+
+    const LinearContainer<int>& linVec = vec;
+    const LinearContainer<int>& linSortable = sortable;
+    const LinearContainer<int>& linSet = setVec;
+    const LinearContainer<int>& linList = list;
+
+    bool equalTest = (linVec == linSortable && linSortable == linSet && linSet == linList && linList == linVec);
+    printTestResult("LinearContainer equality (contiguous and mixed)", equalTest);
+
+    sortable[4] = 100;
+    bool differentTest = (linVec != linSortable && linSortable != linList);
+    printTestResult("LinearContainer inequality after modification", differentTest);
+
+    // Virtual entry points through the base class reach the array walk
+    MutableLinearContainer<int>& mutVec = vec;
+    mutVec.PostOrderMap(typename MappableContainer<int>::MapFun([](int& x) { x += 1; }));
+    string post = linVec.PostOrderFold(typename TraversableContainer<int>::FoldFun<string>([](const int& x, const string& acc) {
+        return acc + to_string(x) + " ";
+    }), string(""));
+    bool postTest = (post == "9 7 5 3 1 ");
+    printTestResult("PostOrderMap / PostOrderFold through base references", postTest);
+    cout << "  - Expected: 9 7 5 3 1, Actual: " << post << endl;
+
+    allTestsPassed &= (equalTest && differentTest && postTest);
+    cout << "Overall contiguous test result: " << (allTestsPassed ? "SUCCESS" : "FAILURE") << endl;
+}
+
+void testCursorAlgorithms() {
+    cout << "\n=== Cursor-based Linear Algorithms Test ===" << endl;
+    bool allTestsPassed = true;
+
+    // Abbastanza elementi da rendere evidente un comportamento quadratico sulle liste
+    const unsigned long count = 50000;
+    List<int> list;
+    SetLst<int> setLst;
+    for (unsigned long i = 0; i < count; i++) {
+        list.InsertAtBack(static_cast<int>(i));
+        setLst.Insert(static_cast<int>(count - 1 - i));
+    }
+    SetVec<int> setVec(list);
+
+    const LinearContainer<int>& linList = list;
+    const LinearContainer<int>& linSetLst = setLst;
+    const LinearContainer<int>& linSetVec = setVec;
+
+    bool equalTest = (linSetLst == linSetVec && linList == linSetLst && setLst == setVec);
+    printTestResult("Large SetLst == SetVec / List == SetLst", equalTest);
+
+    list.Back() = -1;
+    bool differentTest = (linList != linSetLst);
+    printTestResult("Mismatch detected on the last element", differentTest);
+
+    long preSum = linSetLst.PreOrderFold(typename TraversableContainer<int>::FoldFun<long>([](const int& x, const long& acc) {
+        return acc + x;
+    }), 0L);
+    bool preFoldTest = (preSum == static_cast<long>(count) * (count - 1) / 2);
+    printTestResult("PreOrderFold on a large SetLst", preFoldTest);
+
+    List<int> small;
+    for (int i = 1; i <= 5; i++) {
+        small.InsertAtBack(i);
+    }
+    MutableLinearContainer<int>& mutSmall = small;
+    string visited;
+    mutSmall.PostOrderMap(typename MappableContainer<int>::MapFun([&visited](int& x) {
+        visited += to_string(x) + " ";
+        x *= 10;
+    }));
+    bool postMapTest = (visited == "5 4 3 2 1 " && small.Front() == 10 && small.Back() == 50);
+    printTestResult("PostOrderMap on List through the base class", postMapTest);
+
+    bool reachedAll = static_cast<const LinearContainer<int>&>(small).PostOrderTraverseWhile([](const int& x) {
+        return x > 20;
+    });
+    printTestResult("PostOrderTraverseWhile stops in reverse order", !reachedAll);
+
+    SortableVector<int> sortable(5);
+    int values[] = {4, 1, 3, 1, 2};
+    for (unsigned long i = 0; i < sortable.Size(); i++) {
+        sortable[i] = values[i];
+    }
+    sortable.Sort();
+    bool sortTest = (sortable[0] == 1 && sortable[1] == 1 && sortable[2] == 2 && sortable[3] == 3 && sortable[4] == 4);
+    printTestResult("Sort with cursor-based partition", sortTest);
+
+    allTestsPassed &= (equalTest && differentTest && preFoldTest && postMapTest && !reachedAll && sortTest);
+    cout << "Overall cursor test result: " << (allTestsPassed ? "SUCCESS" : "FAILURE") << endl;
+}
+
+template <typename ContainerType>
+void testTraverseChunks(const string& containerName, unsigned long expectedChunks) {
+    cout << "\n=== TraverseChunks Test for " << containerName << " ===" << endl;
+    bool allTestsPassed = true;
+
+    const unsigned long count = 150;
+    Vector<int> source(count);
+    for (unsigned long i = 0; i < count; i++) {
+        source[i] = static_cast<int>(i);
+    }
+    ContainerType container(source);
+    const TraversableContainer<int>& traversable = container;
+
+    unsigned long chunks = 0;
+    unsigned long elements = 0;
+    long sum = 0;
+    bool ordered = true;
+    int expected = 0;
+    traversable.TraverseChunks([&](std::span<const int> chunk) {
+        chunks++;
+        elements += chunk.size();
+        for (const int& value : chunk) {
+            ordered &= (value == expected++);
+            sum += value;
+        }
+    });
+
+    bool chunkTest = (chunks == expectedChunks && elements == count && ordered);
+    printTestResult(containerName + " chunks cover every element in order", chunkTest);
+    cout << "  - Chunks: " << chunks << " (expected " << expectedChunks << "), elements: " << elements << endl;
+
+    bool sumTest = (sum == static_cast<long>(count) * (count - 1) / 2);
+    printTestResult(containerName + " chunk sum", sumTest);
+
+    ContainerType empty;
+    unsigned long emptyChunks = 0;
+    static_cast<const TraversableContainer<int>&>(empty).TraverseChunks([&emptyChunks](std::span<const int>) {
+        emptyChunks++;
+    });
+    bool emptyTest = (emptyChunks == 0);
+    printTestResult(containerName + " empty container gives no chunks", emptyTest);
+
+    allTestsPassed &= (chunkTest && sumTest && emptyTest);
+    cout << "Overall TraverseChunks result for " << containerName << ": " << (allTestsPassed ? "SUCCESS" : "FAILURE") << endl;
+}
+
+void testLazyViews() {
+    cout << "\n=== Lazy Views Test ===" << endl;
+    bool allTestsPassed = true;
+
+    List<int> source;
+    for (int i = 1; i <= 20; i++) {
+        source.InsertAtBack(i);
+    }
+
+    // Nessuna chiamata finche' la vista non viene visitata
+    unsigned long calls = 0;
+    View<int> scaled = View<int>(source).Transform([&calls](const int& x) {
+        calls++;
+        return x * 10;
+    });
+    bool lazyTest = (calls == 0 && scaled.Size() == 20);
+    printTestResult("Transform is lazy and keeps the size", lazyTest);
+
+    // Pari, scartato il primo, al piu' tre elementi: 40 60 80
+    View<int> pipeline = scaled.Take(10).Filter([](const int& x) { return x % 20 == 0; }).Drop(1).Take(3);
+    calls = 0;
+    Vector<int> vec(pipeline);
+    List<int> list(pipeline);
+    SetVec<int> setVec(pipeline);
+    SetLst<int> setLst(pipeline);
+    const LinearContainer<int>& linVec = vec;
+    bool buildTest = (vec.Size() == 3 && vec[0] == 40 && vec[1] == 60 && vec[2] == 80 &&
+                      linVec == list && linVec == setVec && linVec == setLst);
+    printTestResult("Vector/List/SetVec/SetLst built from a fused pipeline", buildTest);
+
+    // Take ferma la sorgente: ogni costruzione visita solo i primi otto elementi
+    bool fusedTest = (calls == 4 * 8);
+    printTestResult("Take stops the source traversal early", fusedTest);
+    cout << "  - Transform calls: " << calls << " (expected 32)" << endl;
+
+    long sum = pipeline.Fold(typename TraversableContainer<int>::FoldFun<long>([](const int& x, const long& acc) {
+        return acc + x;
+    }), 0L);
+    bool foldTest = (sum == 180 && pipeline.Exists(60) && !pipeline.Exists(20));
+    printTestResult("Fold / Exists through the view", foldTest);
+
+    View<string> labels = View<int>(source).Drop(18).Transform([](const int& x) { return "n" + to_string(x); });
+    Vector<string> labelVec(labels);
+    bool typeTest = (labelVec.Size() == 2 && labelVec[0] == "n19" && labelVec[1] == "n20");
+    printTestResult("Transform to a different type", typeTest);
+
+    View<int> emptyView = View<int>(source).Drop(100).Filter([](const int&) { return true; });
+    bool emptyTest = (emptyView.Empty() && View<int>(source).Take(0).Empty());
+    printTestResult("Empty views", emptyTest);
+
+    // La sorgente cresce dopo la creazione della vista: la dimensione registrata resta un suggerimento
+    List<int> growing;
+    for (int i = 0; i < 4; i++) {
+        growing.InsertAtBack(i);
+    }
+    View<int> live(growing);
+    View<int> liveTail = live.Drop(2);
+    for (int i = 4; i < 8; i++) {
+        growing.InsertAtBack(i);
+    }
+    Vector<int> grownVec(live);
+    LeanVector<int> grownLean(liveTail);
+    bool hintTest = (grownVec.Size() == 8 && grownVec[7] == 7 && grownLean.Size() == 6 && grownLean[5] == 7);
+
+    // Filter conta alla creazione (una visita), poi la materializzazione ne fa una sola
+    unsigned long transformCalls = 0;
+    unsigned long filterCalls = 0;
+    View<int> sparse = View<int>(growing).Transform([&transformCalls](const int& x) {
+        transformCalls++;
+        return x * 3;
+    }).Filter([&filterCalls](const int& x) {
+        filterCalls++;
+        return x % 2 == 0;
+    });
+    hintTest &= (transformCalls == 8 && filterCalls == 8);
+    Vector<int> sparseVec(sparse);
+    hintTest &= (transformCalls == 16 && filterCalls == 16 && sparseVec.Size() == 4 && sparseVec[3] == 18);
+
+    // Size() ed Empty() esatti anche attraverso TraversableContainer
+    View<int> none = View<int>(growing).Take(4).Filter([](const int& x) { return x > 10; });
+    const TraversableContainer<int>& noneBase = none;
+    const TraversableContainer<int>& sparseBase = sparse;
+    hintTest &= (noneBase.Size() == 0 && noneBase.Empty() && sparseBase.Size() == 4 && !sparseBase.Empty() &&
+                 none.Size() == 0 && sparse.Size() == 4);
+    printTestResult("Materializing tolerates a grown source, view sizes are exact through the base", hintTest);
+
+    allTestsPassed &= (lazyTest && buildTest && fusedTest && foldTest && typeTest && emptyTest && hintTest);
+    cout << "Overall lazy views result: " << (allTestsPassed ? "SUCCESS" : "FAILURE") << endl;
+}
+
+void testZipAlgorithms() {
+    cout << "\n=== ZipFold / ZipMap Test ===" << endl;
+    bool allTestsPassed = true;
+
+    Vector<int> left(4);
+    Vector<int> right(4);
+    List<int> list;
+    for (int i = 0; i < 4; i++) {
+        left[i] = i + 1;      // 1 2 3 4
+        right[i] = 2 * i;     // 0 2 4 6
+        list.InsertAtBack(2 * i);
+    }
+
+    auto dot = [](const int& x, const int& y, const long& acc) { return acc + static_cast<long>(x) * y; };
+    const LinearContainer<int>& baseList = list;
+    const LinearContainer<int>& baseLeft = left;
+    bool dotTest = (left.ZipFold(right, dot, 0L) == 40 && left.ZipFold(baseList, dot, 0L) == 40 &&
+                    baseList.ZipFold(baseLeft, dot, 0L) == 40);
+    printTestResult("ZipFold dot product (Vector/Vector, Vector/List, List/Vector)", dotTest);
+
+    SetLst<int> setLst(left);
+    SetVec<int> setVec(right);
+    long diffs = setLst.ZipFold(setVec, typename LinearContainer<int>::ZipFoldFun<long>(
+        [](const int& x, const int& y, const long& acc) { return acc + (x != y ? 1 : 0); }), 0L);
+    bool diffTest = (diffs == 3);
+    printTestResult("ZipFold diff count through std::function (SetLst/SetVec)", diffTest);
+
+    list.ZipMap(left, [](int& x, const int& y) { x += y; });
+    left.ZipMap(left, [](int& x, const int& y) { x = x * y; });
+    bool mapTest = (list.Front() == 1 && list.Back() == 10 && left[0] == 1 && left[3] == 16);
+    printTestResult("ZipMap on List and Vector (including self)", mapTest);
+
+    bool mismatchTest = false;
+    Vector<int> shorter(3);
+    try {
+        left.ZipFold(shorter, dot, 0L);
+    } catch (const length_error&) {
+        try {
+            list.ZipMap(shorter, [](int&, const int&) {});
+        } catch (const length_error&) {
+            mismatchTest = true;
+        }
+    }
+    printTestResult("Size mismatch throws length_error", mismatchTest);
+
+    allTestsPassed &= (dotTest && diffTest && mapTest && mismatchTest);
+    cout << "Overall zip test result: " << (allTestsPassed ? "SUCCESS" : "FAILURE") << endl;
+}
+
+// Accumulatore che conta le copie subite durante la fold
+struct CopyCountingAccumulator {
+    static unsigned long copies;
+    string text;
+
+    CopyCountingAccumulator() = default;
+    CopyCountingAccumulator(const CopyCountingAccumulator& other) : text(other.text) { copies++; }
+    CopyCountingAccumulator(CopyCountingAccumulator&&) noexcept = default;
+    CopyCountingAccumulator& operator=(const CopyCountingAccumulator& other) { text = other.text; copies++; return *this; }
+    CopyCountingAccumulator& operator=(CopyCountingAccumulator&&) noexcept = default;
+};
+
+unsigned long CopyCountingAccumulator::copies = 0;
+
+template <typename ContainerType>
+void testFoldMove(const string& containerName) {
+    cout << "\n=== Move-aware Fold Test for " << containerName << " ===" << endl;
+    bool allTestsPassed = true;
+
+    Vector<int> source(5);
+    for (unsigned long i = 0; i < source.Size(); i++) {
+        source[i] = static_cast<int>(i) + 1;
+    }
+    ContainerType container(source);
+
+    auto append = [](const int& x, CopyCountingAccumulator&& acc) {
+        acc.text += to_string(x);
+        return std::move(acc);
+    };
+
+    CopyCountingAccumulator::copies = 0;
+    string pre = container.FoldMove(append, CopyCountingAccumulator()).text;
+    string preOrder = container.PreOrderFoldMove(append, CopyCountingAccumulator()).text;
+    string postOrder = container.PostOrderFoldMove(append, CopyCountingAccumulator()).text;
+    bool concreteTest = (pre == "12345" && preOrder == "12345" && postOrder == "54321" && CopyCountingAccumulator::copies == 0);
+    printTestResult(containerName + " FoldMove / PreOrderFoldMove / PostOrderFoldMove without copies", concreteTest);
+    cout << "  - Copies: " << CopyCountingAccumulator::copies << endl;
+
+    const TraversableContainer<int>& traversable = container;
+    const PreOrderTraversableContainer<int>& preTraversable = container;
+    const PostOrderTraversableContainer<int>& postTraversable = container;
+    typename TraversableContainer<int>::FoldMoveFun<CopyCountingAccumulator> appendFun = append;
+    CopyCountingAccumulator::copies = 0;
+    string basePre = traversable.FoldMove(appendFun, CopyCountingAccumulator()).text;
+    string basePreOrder = preTraversable.PreOrderFoldMove(appendFun, CopyCountingAccumulator()).text;
+    string basePostOrder = postTraversable.PostOrderFoldMove(appendFun, CopyCountingAccumulator()).text;
+    bool baseTest = (basePre == "12345" && basePreOrder == "12345" && basePostOrder == "54321" && CopyCountingAccumulator::copies == 0);
+    printTestResult(containerName + " FoldMove through the base classes without copies", baseTest);
+
+    allTestsPassed &= (concreteTest && baseTest);
+    cout << "Overall FoldMove result for " << containerName << ": " << (allTestsPassed ? "SUCCESS" : "FAILURE") << endl;
+}
+
+template <typename ContainerType>
+void testRangeOperations(const string& containerName) {
+    cout << "\n=== Range Traversal Test for " << containerName << " ===" << endl;
+    bool allTestsPassed = true;
+
+    Vector<int> source(10);
+    for (unsigned long i = 0; i < source.Size(); i++) {
+        source[i] = static_cast<int>(i);
+    }
+    ContainerType container(source);
+
+    string pre;
+    string post;
+    container.TraverseRange(2, 6, [&pre](const int& x) { pre += to_string(x); });
+    container.PostOrderTraverseRange(2, 6, [&post](const int& x) { post += to_string(x); });
+    bool traverseTest = (pre == "2345" && post == "5432");
+    printTestResult(containerName + " Pre/PostOrderTraverseRange [2, 6)", traverseTest);
+
+    typename TraversableContainer<int>::FoldFun<string> concat = [](const int& x, const string& acc) { return acc + to_string(x); };
+    bool foldTest = (container.FoldRange(7, 10, concat, string("")) == "789" &&
+                     container.PostOrderFoldRange(0, 3, concat, string("")) == "210" &&
+                     container.PreOrderFoldRange(4, 4, concat, string("empty")) == "empty");
+    printTestResult(containerName + " FoldRange / PostOrderFoldRange / empty range", foldTest);
+
+    container.MapRange(0, 2, [](int& x) { x += 100; });
+    string order;
+    container.PostOrderMapRange(8, 10, [&order](int& x) { order += to_string(x); x = -x; });
+    bool mapTest = (container[0] == 100 && container[1] == 101 && container[2] == 2 &&
+                    order == "98" && container[8] == -8 && container[9] == -9 && container[7] == 7);
+    printTestResult(containerName + " MapRange / PostOrderMapRange", mapTest);
+
+    bool exceptionTest = false;
+    try {
+        container.TraverseRange(5, 11, [](const int&) {});
+    } catch (const out_of_range&) {
+        try {
+            container.MapRange(6, 5, [](int&) {});
+        } catch (const out_of_range&) {
+            exceptionTest = true;
+        }
+    }
+    printTestResult(containerName + " invalid ranges throw out_of_range", exceptionTest);
+
+    allTestsPassed &= (traverseTest && foldTest && mapTest && exceptionTest);
+    cout << "Overall range result for " << containerName << ": " << (allTestsPassed ? "SUCCESS" : "FAILURE") << endl;
+}
+
+template <typename SetType>
+void testNonThrowingLookups(const string& setName) {
+    cout << "\n=== Non-throwing Lookup Test for " << setName << " ===" << endl;
+    bool allTestsPassed = true;
+
+    SetType set;
+    bool emptyTest = (set.TryMin() == nullptr && set.TryMax() == nullptr && set.TryFront() == nullptr &&
+                      set.TryBack() == nullptr && set.TryPredecessor(5) == nullptr && set.TrySuccessor(5) == nullptr);
+    printTestResult(setName + " Try* on an empty set return nullptr", emptyTest);
+
+    for (int value : {10, 20, 30, 40}) {
+        set.Insert(value);
+    }
+    const OrderedDictionaryContainer<int>& ordered = set;
+    bool foundTest = (*ordered.TryMin() == 10 && *ordered.TryMax() == 40 && *set.TryFront() == 10 && *set.TryBack() == 40 &&
+                      *ordered.TryPredecessor(30) == 20 && *ordered.TryPredecessor(25) == 20 &&
+                      *ordered.TrySuccessor(20) == 30 && *ordered.TrySuccessor(5) == 10);
+    printTestResult(setName + " Try* find existing elements", foundTest);
+
+    bool missingTest = (ordered.TryPredecessor(10) == nullptr && ordered.TrySuccessor(40) == nullptr &&
+                        ordered.TrySuccessor(45) == nullptr && ordered.TryPredecessor(5) == nullptr);
+    printTestResult(setName + " Try* return nullptr past the ends", missingTest);
+
+    // Scansione per successori terminata dal nullptr, senza eccezioni
+    string walk;
+    for (const int* current = ordered.TryMin(); current != nullptr; current = ordered.TrySuccessor(*current)) {
+        walk += to_string(*current) + " ";
+    }
+    bool walkTest = (walk == "10 20 30 40 ");
+    printTestResult(setName + " successor walk", walkTest);
+
+    bool wrapperTest = false;
+    try {
+        ordered.Successor(40);
+    } catch (const length_error&) {
+        wrapperTest = (ordered.Successor(30) == 40 && ordered.Predecessor(20) == 10);
+    }
+    printTestResult(setName + " throwing wrappers keep their behaviour", wrapperTest);
+
+    allTestsPassed &= (emptyTest && foundTest && missingTest && walkTest && wrapperTest);
+    cout << "Overall non-throwing lookup result for " << setName << ": " << (allTestsPassed ? "SUCCESS" : "FAILURE") << endl;
+}
+
+// Tipo ordinabile che conta le copie (gli spostamenti sono gratuiti)
+struct CountedValue {
+    static unsigned long copies;
+    int key = 0;
+
+    CountedValue() = default;
+    explicit CountedValue(int value) : key(value) {}
+    CountedValue(const CountedValue& other) : key(other.key) { copies++; }
+    CountedValue(CountedValue&&) noexcept = default;
+    CountedValue& operator=(const CountedValue& other) { key = other.key; copies++; return *this; }
+    CountedValue& operator=(CountedValue&&) noexcept = default;
+
+    bool operator==(const CountedValue& other) const noexcept { return key == other.key; }
+    auto operator<=>(const CountedValue& other) const noexcept { return key <=> other.key; }
+};
+
+unsigned long CountedValue::copies = 0;
+
+void testMoveOutRemoval() {
+    cout << "\n=== Move-out NRemove Test ===" << endl;
+    bool allTestsPassed = true;
+
+    List<CountedValue> list;
+    for (int i = 1; i <= 4; i++) {
+        list.InsertAtBack(CountedValue(i));
+    }
+    CountedValue::copies = 0;
+    CountedValue front = list.FrontNRemove();
+    CountedValue back = list.BackNRemove();
+    bool listTest = (front.key == 1 && back.key == 4 && list.Size() == 2 && CountedValue::copies == 0);
+    printTestResult("List FrontNRemove / BackNRemove move the value out", listTest);
+    cout << "  - Copies: " << CountedValue::copies << endl;
+
+    SetLst<CountedValue> setLst;
+    SetVec<CountedValue> setVec;
+    for (int i = 1; i <= 6; i++) {
+        setLst.Insert(CountedValue(i));
+        setVec.Insert(CountedValue(i));
+    }
+    bool insertTest = (CountedValue::copies == 0);
+    printTestResult("Set insertion of rvalues moves the surviving elements", insertTest);
+
+    CountedValue key(4);
+    CountedValue::copies = 0;
+    bool setLstTest = (setLst.MinNRemove().key == 1 && setLst.MaxNRemove().key == 6 &&
+                       setLst.PredecessorNRemove(key).key == 3 && setLst.SuccessorNRemove(key).key == 5 &&
+                       setLst.Size() == 2 && CountedValue::copies == 0);
+    printTestResult("SetLst Min/Max/Predecessor/SuccessorNRemove without copies", setLstTest);
+
+    bool setVecTest = (setVec.MinNRemove().key == 1 && setVec.MaxNRemove().key == 6 &&
+                       setVec.PredecessorNRemove(key).key == 3 && setVec.SuccessorNRemove(key).key == 5 &&
+                       setVec.Size() == 2 && setVec[0].key == 2 && setVec[1].key == 4 && CountedValue::copies == 0);
+    printTestResult("SetVec Min/Max/Predecessor/SuccessorNRemove without copies", setVecTest);
+    cout << "  - Copies: " << CountedValue::copies << endl;
+
+    allTestsPassed &= (listTest && insertTest && setLstTest && setVecTest);
+    cout << "Overall move-out result: " << (allTestsPassed ? "SUCCESS" : "FAILURE") << endl;
+}
+
+// Tipo ordinabile solo spostabile e senza costruttore di default
+struct MoveOnlyKey {
+    unique_ptr<int> key;
+
+    explicit MoveOnlyKey(int value) : key(make_unique<int>(value)) {}
+    MoveOnlyKey(MoveOnlyKey&&) noexcept = default;
+    MoveOnlyKey& operator=(MoveOnlyKey&&) noexcept = default;
+
+    bool operator==(const MoveOnlyKey& other) const noexcept { return *key == *other.key; }
+    auto operator<=>(const MoveOnlyKey& other) const noexcept { return *key <=> *other.key; }
+};
+
+void testMoveOnlyElements() {
+    cout << "\n=== Move-only and Non-default-constructible Data Test ===" << endl;
+    bool allTestsPassed = true;
+
+    static_assert(!is_default_constructible_v<MoveOnlyKey> && !is_copy_constructible_v<MoveOnlyKey>);
+
+    List<unique_ptr<int>> handles;
+    for (int i = 1; i <= 4; i++) {
+        handles.InsertAtBack(make_unique<int>(i));
+    }
+    handles.InsertAtFront(make_unique<int>(0));
+    unique_ptr<int> first = handles.FrontNRemove();
+    Vector<unique_ptr<int>> moved(std::move(handles));
+    int total = 0;
+    moved.Traverse([&total](const unique_ptr<int>& p) { total += *p; });
+    bool handleTest = (*first == 0 && moved.Size() == 4 && total == 10 && *moved.Back() == 4);
+    printTestResult("List/Vector of unique_ptr (insert, pop, build from MappableContainer&&)", handleTest);
+
+    moved.Resize(2);
+    bool resizeTest = (moved.Size() == 2 && *moved[1] == 2);
+    moved.Resize(3);
+    resizeTest &= (moved.Size() == 3 && moved[2] == nullptr);
+    printTestResult("Vector<unique_ptr> Resize moves the surviving elements", resizeTest);
+
+    SetVec<MoveOnlyKey> setVec;
+    SetLst<MoveOnlyKey> setLst;
+    for (int value : {5, 1, 3, 5, 2, 4}) {
+        setVec.Insert(MoveOnlyKey(value));
+        setLst.Insert(MoveOnlyKey(value));
+    }
+    MoveOnlyKey probe(3);
+    bool setTest = (setVec.Size() == 5 && setLst.Size() == 5 && *setVec.Min().key == 1 && *setLst.Max().key == 5 &&
+                    setVec.Exists(probe) && setLst.Remove(probe) && !setLst.Exists(probe) &&
+                    *setVec.SuccessorNRemove(probe).key == 4 && *setLst.MinNRemove().key == 1 && setVec.Remove(probe));
+    printTestResult("SetVec/SetLst of a move-only, non-default-constructible key", setTest);
+
+    // Attraverso l'interfaccia base: le NRemove sono pure, quindi si arriva sempre alla versione che sposta
+    OrderedDictionaryContainer<MoveOnlyKey>& ordered = setVec;
+    bool baseTest = (*ordered.MaxNRemove().key == 5 && *ordered.PredecessorNRemove(MoveOnlyKey(2)).key == 1 && setVec.Size() == 1);
+    static_assert(is_abstract_v<OrderedDictionaryContainer<int>>);
+    printTestResult("NRemove of a move-only key through OrderedDictionaryContainer&", baseTest);
+
+    bool copyInsertTest = false;
+    try {
+        static_cast<DictionaryContainer<MoveOnlyKey>&>(setVec).Insert(static_cast<const MoveOnlyKey&>(probe));
+    } catch (const logic_error&) {
+        copyInsertTest = true;
+    }
+    printTestResult("Copy insertion of a move-only key throws logic_error", copyInsertTest);
+
+    Vector<MoveOnlyKey> keys(std::move(setLst));
+    bool growTest = false;
+    try {
+        keys.Resize(keys.Size() + 1);
+    } catch (const length_error&) {
+        growTest = (keys.Size() == 3 && *keys.Front().key == 2);
+    }
+    printTestResult("Growing a Vector of non-default-constructible data throws length_error", growTest);
+
+    unsigned long chunks = 0;
+    static_cast<const TraversableContainer<MoveOnlyKey>&>(setVec).TraverseChunks([&chunks](span<const MoveOnlyKey>) { chunks++; });
+    bool chunkTest = (chunks == 1);
+    printTestResult("TraverseChunks over contiguous move-only data", chunkTest);
+
+    allTestsPassed &= (handleTest && resizeTest && setTest && baseTest && copyInsertTest && growTest && chunkTest);
+    cout << "Overall move-only result: " << (allTestsPassed ? "SUCCESS" : "FAILURE") << endl;
+}
+
+struct EmplacedPair {
+    static unsigned long constructions;
+    static unsigned long copies;
+    int key = 0;
+    int weight = 0;
+
+    EmplacedPair(int k, int w) : key(k), weight(w) { constructions++; }
+    EmplacedPair(const EmplacedPair& other) : key(other.key), weight(other.weight) { copies++; }
+    EmplacedPair(EmplacedPair&&) noexcept = default;
+    EmplacedPair& operator=(const EmplacedPair& other) { key = other.key; weight = other.weight; copies++; return *this; }
+    EmplacedPair& operator=(EmplacedPair&&) noexcept = default;
+
+    bool operator==(const EmplacedPair& other) const noexcept { return key == other.key; }
+    auto operator<=>(const EmplacedPair& other) const noexcept { return key <=> other.key; }
+};
+
+unsigned long EmplacedPair::constructions = 0;
+unsigned long EmplacedPair::copies = 0;
+
+// Inserimento a indice libero: ammesso sui vettori, non sui set (romperebbe ordine e unicita')
+template <typename Container>
+concept EmplacesAtIndex = requires(Container& container) { container.EmplaceAt(0UL, 1); };
+
+static_assert(EmplacesAtIndex<Vector<int>> && !EmplacesAtIndex<SetVec<int>> && !EmplacesAtIndex<FinalSetVec<int>>);
+
+template <typename SetType>
+bool emplaceIntoSet(SetType& set) {
+    bool ok = set.Emplace(3, 30) && set.Emplace(1, 10) && set.Emplace(5, 50) && set.Emplace(4, 40);
+    ok &= !set.Emplace(3, 99); // Duplicato: rifiutato
+    ok &= set.Emplace(EmplacedPair(2, 20));
+    ok &= (set.Size() == 5 && set.Min().key == 1 && set.Max().key == 5 &&
+           set.Successor(EmplacedPair(3, 0)).weight == 40 && set.Predecessor(EmplacedPair(3, 0)).weight == 20);
+    return ok;
+}
+
+void testEmplace() {
+    cout << "\n=== Emplace Test ===" << endl;
+    bool allTestsPassed = true;
+
+    EmplacedPair::constructions = EmplacedPair::copies = 0;
+    List<EmplacedPair> list;
+    list.EmplaceAtBack(2, 20);
+    list.EmplaceAtFront(1, 10).weight++;
+    list.EmplaceAtBack(3, 30);
+    bool listTest = (list.Size() == 3 && list.Front().weight == 11 && list.Back().key == 3 &&
+                     EmplacedPair::constructions == 3 && EmplacedPair::copies == 0);
+    printTestResult("List EmplaceAtFront / EmplaceAtBack build in the node", listTest);
+
+    EmplacedPair::constructions = EmplacedPair::copies = 0;
+    Vector<EmplacedPair> vec(std::move(list));
+    vec.EmplaceAt(0, 0, 0);
+    vec.EmplaceAt(2, 9, 90);
+    vec.EmplaceAt(vec.Size(), 4, 40);
+    bool vecTest = (vec.Size() == 6 && vec[0].key == 0 && vec[1].key == 1 && vec[2].key == 9 &&
+                    vec[3].key == 2 && vec[5].key == 4 && EmplacedPair::constructions == 3 && EmplacedPair::copies == 0);
+    try {
+        vec.EmplaceAt(vec.Size() + 1, 7, 70);
+        vecTest = false;
+    } catch (const out_of_range&) {
+        vecTest &= (vec.Size() == 6);
+    }
+    printTestResult("Vector EmplaceAt (front, middle, back, out of range)", vecTest);
+
+    EmplacedPair::constructions = EmplacedPair::copies = 0;
+    SetVec<EmplacedPair> setVec;
+    SetLst<EmplacedPair> setLst;
+    bool setTest = emplaceIntoSet(setVec) && emplaceIntoSet(setLst);
+    setTest &= (EmplacedPair::copies == 0);
+    printTestResult("SetVec/SetLst Emplace keeps order and rejects duplicates", setTest);
+    cout << "  - Copies: " << EmplacedPair::copies << endl;
+
+    allTestsPassed &= (listTest && vecTest && setTest);
+    cout << "Overall emplace result: " << (allTestsPassed ? "SUCCESS" : "FAILURE") << endl;
+}
+
+template <typename SetType>
+bool lookupByView(SetType& set) {
+    // string_view non e' convertibile implicitamente in string: nessuna stringa temporanea
+    for (const char* word : {"delta", "alpha", "echo", "charlie", "bravo"}) {
+        set.Insert(string(word));
+    }
+    const OrderedDictionaryContainer<string>& dictionary = set;
+    string_view buffer = "bravo charlie zulu";
+    string_view bravo = buffer.substr(0, 5);
+    string_view charlie = buffer.substr(6, 7);
+    string_view zulu = buffer.substr(14);
+
+    bool ok = set.Exists(bravo) && dictionary.Exists(charlie) && !set.Exists(zulu) && !set.Exists(string_view("b"));
+    ok &= (set.Predecessor(charlie) == "bravo" && dictionary.Successor(charlie) == "delta" &&
+           set.Successor(string_view("b")) == "bravo" && set.Predecessor(zulu) == "echo");
+    ok &= (set.TrySuccessor(zulu) == nullptr && dictionary.TryPredecessor(string_view("alpha")) == nullptr);
+    try {
+        set.Successor(zulu);
+        ok = false;
+    } catch (const length_error&) {}
+    ok &= (set.Remove(charlie) && !set.Remove(charlie) && set.Size() == 4 && !set.Exists(string("charlie")));
+    return ok;
+}
+
+// Comparatore trasparente con l'ordine rovesciato
+struct ReversedText {
+    weak_ordering operator()(string_view left, string_view right) const { return right <=> left; }
+};
+
+void testHeterogeneousLookup() {
+    cout << "\n=== Heterogeneous Lookup Test ===" << endl;
+    bool allTestsPassed = true;
+
+    SetVec<string> setVec;
+    SetLst<string> setLst;
+    bool setVecTest = lookupByView(setVec);
+    printTestResult("SetVec<string> lookups by string_view", setVecTest);
+    bool setLstTest = lookupByView(setLst);
+    printTestResult("SetLst<string> lookups by string_view", setLstTest);
+
+    Vector<string> words(3);
+    words[0] = "x";
+    words[1] = "y";
+    words[2] = "z";
+    bool scanTest = words.Exists(string_view("y")) && !words.Exists(string_view("w")) && words.Exists(string("z"));
+    printTestResult("Vector<string>::Exists by string_view (linear scan)", scanTest);
+
+    // Ordinamento rovesciato: le versioni proprie usano Compare, l'interfaccia base rifiuta le chiavi
+    SetVec<string, ReversedText> reversedVec;
+    SetLst<string, ReversedText> reversedLst;
+    for (const char* word : {"b", "d", "a"}) {
+        reversedVec.Insert(string(word));
+        reversedLst.Insert(string(word));
+    }
+    bool reversedTest = (reversedVec.Exists(string_view("b")) && reversedLst.Exists(string_view("b")) &&
+                         *reversedVec.TryPredecessor(string_view("c")) == "d" && *reversedLst.TryPredecessor(string_view("c")) == "d" &&
+                         *reversedVec.TrySuccessor(string_view("c")) == "b" && reversedVec.Front() == "d");
+    unsigned long refused = 0;
+    auto refuses = [&refused](auto&& call) {
+        try {
+            call();
+        } catch (const logic_error&) {
+            refused++;
+        }
+    };
+    refuses([&] { static_cast<DictionaryContainer<string>&>(reversedVec).Exists(string_view("b")); });
+    refuses([&] { static_cast<DictionaryContainer<string>&>(reversedLst).Exists(string_view("b")); });
+    refuses([&] { static_cast<DictionaryContainer<string>&>(reversedVec).Remove(string_view("b")); });
+    refuses([&] { static_cast<OrderedDictionaryContainer<string>&>(reversedVec).TryPredecessor(string_view("c")); });
+    refuses([&] { static_cast<OrderedDictionaryContainer<string>&>(reversedLst).TrySuccessor(string_view("c")); });
+    reversedTest &= (refused == 5 && reversedVec.Size() == 3 && reversedLst.Size() == 3 &&
+                     static_cast<DictionaryContainer<string>&>(reversedVec).Exists(string("b")));
+    printTestResult("Custom Compare: own overloads ordered by it, base key lookups refused", reversedTest);
+
+    // Chiavi aritmetiche su dati aritmetici: convertite in Data come prima (2.5 -> 2)
+    SetVec<int> ints;
+    SetLst<int> intList;
+    ints.Insert(2);
+    intList.Insert(2);
+    static_assert(!HeterogeneousKey<double, int> && HeterogeneousKey<string_view, string>);
+    bool arithmeticTest = (ints.Exists(2.5) && intList.Exists(2.5) && static_cast<const TestableContainer<int>&>(ints).Exists(2.5) &&
+                           !ints.Exists(3.5));
+    printTestResult("Arithmetic keys convert to Data", arithmeticTest);
+
+    allTestsPassed &= (setVecTest && setLstTest && scanTest && reversedTest && arithmeticTest);
+    cout << "Overall heterogeneous lookup result: " << (allTestsPassed ? "SUCCESS" : "FAILURE") << endl;
+}
+
+struct CountingCompare {
+    static unsigned long calls;
+
+    template <typename Left, typename Right>
+    auto operator()(const Left& left, const Right& right) const {
+        calls++;
+        return left <=> right;
+    }
+};
+
+unsigned long CountingCompare::calls = 0;
+
+struct Descending {
+    auto operator()(int left, int right) const { return right <=> left; }
+};
+
+struct BySecond {
+    auto operator()(const pair<int, string>& left, const pair<int, string>& right) const { return left.second <=> right.second; }
+};
+
+struct CaseFolded {
+    weak_ordering operator()(string_view left, string_view right) const {
+        return lexicographical_compare_three_way(left.begin(), left.end(), right.begin(), right.end(),
+            [](char x, char y) { return tolower(static_cast<unsigned char>(x)) <=> tolower(static_cast<unsigned char>(y)); });
+    }
+};
+
+template <typename SetType>
+bool caseFoldedSet(SetType& set) {
+    for (const char* word : {"Bravo", "alpha", "ALPHA", "Charlie", "bravo"}) {
+        set.Insert(string(word));
+    }
+    return set.Size() == 3 && set.Min() == "alpha" &&
+           set.Exists(string_view("BRAVO")) && set.Successor(string_view("ALPHA")) == "Bravo" &&
+           set.Remove(string_view("CHARLIE")) && set.Size() == 2;
+}
+
+void testComparatorPolicy() {
+    cout << "\n=== Three-way Comparison and Comparator Policy Test ===" << endl;
+    bool allTestsPassed = true;
+
+    SetVec<int, CountingCompare> countedVec;
+    SetLst<int, CountingCompare> countedLst;
+    for (int i = 0; i < 1024; i++) {
+        countedVec.Insert(i);
+    }
+    for (int i = 0; i < 64; i++) {
+        countedLst.Insert(i);
+    }
+    CountingCompare::calls = 0;
+    bool found = countedVec.Exists(700);
+    unsigned long vecCalls = CountingCompare::calls;
+    CountingCompare::calls = 0;
+    found &= countedLst.Exists(63);
+    unsigned long lstCalls = CountingCompare::calls;
+    bool probeTest = (found && vecCalls <= 12 && lstCalls == 64);
+    printTestResult("One three-way comparison per probe (SetVec binary search, SetLst walk)", probeTest);
+    cout << "  - SetVec<1024> Exists: " << vecCalls << " comparisons, SetLst<64> Exists: " << lstCalls << endl;
+
+    SetVec<int, Descending> descVec;
+    SetLst<int, Descending> descLst;
+    for (int value : {3, 9, 1, 7, 5}) {
+        descVec.Insert(value);
+        descLst.Insert(value);
+    }
+    bool reverseTest = (descVec.Min() == 9 && descVec.Max() == 1 && descLst.Front() == 9 && descLst.Back() == 1 &&
+                        descVec.Successor(7) == 5 && descLst.Predecessor(7) == 9 && descVec[2] == 5);
+    SortableVector<int, Descending> descSort(5);
+    for (ulong i = 0; i < 5; i++) {
+        descSort[i] = static_cast<int>((i * 3) % 5);
+    }
+    descSort.Sort();
+    reverseTest &= (descSort[0] == 4 && descSort[4] == 0);
+    printTestResult("Reverse comparator on SetVec, SetLst and SortableVector", reverseTest);
+
+    SortableVector<pair<int, string>, BySecond> byField(3);
+    byField[0] = {1, "zeta"};
+    byField[1] = {2, "alpha"};
+    byField[2] = {3, "mu"};
+    byField.Sort();
+    bool fieldTest = (byField[0].first == 2 && byField[1].first == 3 && byField[2].first == 1);
+    printTestResult("SortableVector ordered by a key field", fieldTest);
+
+    SetVec<string, CaseFolded> foldedVec;
+    SetLst<string, CaseFolded> foldedLst;
+    bool foldedTest = caseFoldedSet(foldedVec) && caseFoldedSet(foldedLst);
+    printTestResult("Case-folded sets with string_view lookups", foldedTest);
+
+    allTestsPassed &= (probeTest && reverseTest && fieldTest && foldedTest);
+    cout << "Overall comparator result: " << (allTestsPassed ? "SUCCESS" : "FAILURE") << endl;
+}
+
+static_assert(is_final_v<FinalVector<int>> && is_final_v<FinalList<int>> && is_final_v<FinalSetVec<int>> && is_final_v<FinalSetLst<int>>);
+
+void testFinalTypes() {
+    cout << "\n=== Devirtualized Final Types Test ===" << endl;
+    bool allTestsPassed = true;
+
+    FinalVector<int> vec(4);
+    for (ulong i = 0; i < vec.Size(); i++) {
+        vec[i] = static_cast<int>(i * 10);
+    }
+    const LinearContainer<int>& linear = vec;
+    bool vecTest = (vec.Front() == 0 && vec.Back() == 30 && *vec.TryBack() == 30 && linear[2] == 20 &&
+                    linear.Size() == 4 && !vec.Empty());
+    try {
+        vec[4] = 1;
+        vecTest = false;
+    } catch (const out_of_range&) {}
+    FinalVector<int> emptyVec;
+    try {
+        emptyVec.Front();
+        vecTest = false;
+    } catch (const length_error&) {
+        vecTest &= (emptyVec.TryFront() == nullptr && emptyVec.Empty());
+    }
+    printTestResult("FinalVector accessors (and through LinearContainer&)", vecTest);
+
+    FinalList<int> lst(vec);
+    FinalList<int> lstCopy(lst);
+    lstCopy.InsertAtFront(-1);
+    bool lstTest = (lst.Size() == 4 && lstCopy.Size() == 5 && lstCopy.Front() == -1 && lst.Back() == 30 &&
+                    static_cast<const LinearContainer<int>&>(lst) == static_cast<const LinearContainer<int>&>(vec));
+    lstCopy[2] = 11;
+    lstCopy.Back() = 31;
+    const LinearContainer<int>& linearLst = lstCopy;
+    lstTest &= (lstCopy[2] == 11 && linearLst[2] == 11 && linearLst.Back() == 31 && *lstCopy.TryFront() == -1 &&
+                *lstCopy.TryBack() == 31);
+    try {
+        lstCopy[5] = 1;
+        lstTest = false;
+    } catch (const out_of_range&) {}
+    FinalList<int> emptyLst;
+    try {
+        emptyLst.Back();
+        lstTest = false;
+    } catch (const length_error&) {
+        lstTest &= (emptyLst.TryBack() == nullptr && emptyLst.Empty());
+    }
+    printTestResult("FinalList copy and accessors", lstTest);
+
+    FinalSetVec<int> setVec(lst);
+    FinalSetLst<int, Descending> setLst(lst);
+    setVec.Insert(5);
+    bool setTest = (setVec.Size() == 5 && setVec[1] == 5 && setVec.Min() == 0 && setVec.Max() == 30 &&
+                    *setVec.TryMin() == 0 && setLst.Min() == 30 && setLst.Successor(20) == 10 &&
+                    static_cast<const DictionaryContainer<int>&>(setVec).Exists(5));
+    FinalSetVec<int> movedSet(std::move(setVec));
+    FinalSetLst<int, Descending> copiedLst(setLst);
+    FinalSetLst<int, Descending> movedLst(std::move(setLst));
+    setTest &= (movedSet.Size() == 5 && setVec.Empty() && copiedLst.Size() == 4 && copiedLst.Max() == 0 &&
+                movedLst.Size() == 4 && movedLst.Min() == 30 && setLst.Empty());
+    printTestResult("FinalSetVec / FinalSetLst keep the set contracts", setTest);
+
+    allTestsPassed &= (vecTest && lstTest && setTest);
+    cout << "Overall final types result: " << (allTestsPassed ? "SUCCESS" : "FAILURE") << endl;
+}
+
+template <typename T>
+void printSizeof(const string& name) {
+    cout << "  - sizeof(" << name << ") = " << sizeof(T) << endl;
+}
+
+void testLeanVector() {
+    cout << "\n=== Lean Vector and Footprint Report Test ===" << endl;
+    bool allTestsPassed = true;
+
+    printSizeof<Vector<int>>("Vector<int>");
+    printSizeof<SortableVector<int>>("SortableVector<int>");
+    printSizeof<FinalVector<int>>("FinalVector<int>");
+    printSizeof<List<int>>("List<int>");
+    printSizeof<FinalList<int>>("FinalList<int>");
+    printSizeof<SetVec<int>>("SetVec<int>");
+    printSizeof<FinalSetVec<int>>("FinalSetVec<int>");
+    printSizeof<SetLst<int>>("SetLst<int>");
+    printSizeof<FinalSetLst<int>>("FinalSetLst<int>");
+    printSizeof<View<int>>("View<int>");
+    printSizeof<LeanVector<int>>("LeanVector<int>");
+    printSizeof<LeanVector<string>>("LeanVector<string>");
+    bool footprintTest = (sizeof(LeanVector<int>) >= 16 && sizeof(LeanVector<int>) <= 24 &&
+                          sizeof(LeanVector<string>) == sizeof(LeanVector<int>) && sizeof(LeanVector<int>) < sizeof(Vector<int>));
+    printTestResult("LeanVector footprint within 16-24 bytes", footprintTest);
+
+    List<int> source;
+    for (int i = 1; i <= 5; i++) {
+        source.InsertAtBack(i);
+    }
+    LeanVector<int> row(source);
+    LeanVector<int> copy(row);
+    copy[0] = 10;
+    copy.Resize(6);
+    bool apiTest = (row.Size() == 5 && row.Front() == 1 && row.Back() == 5 && copy[0] == 10 && copy.Back() == 0 &&
+                    row.Exists(3) && !row.Exists(7) && row != copy && row.Fold<long>([](const int& x, const long& acc) { return acc + x; }, 0L) == 15);
+    row.Map([](int& x) { x *= 2; });
+    apiTest &= (row[4] == 10 && *row.TryBack() == 10);
+    try {
+        row[5];
+        apiTest = false;
+    } catch (const out_of_range&) {}
+    printTestResult("LeanVector accessors, Resize, Fold and Map", apiTest);
+
+    Vector<int> fromLean(row.AsView());
+    SetLst<int> setFromLean(row.AsView().Filter([](const int& x) { return x > 4; }));
+    LeanVector<int> moved(std::move(row));
+    vector<LeanVector<int>> adjacency(3);
+    adjacency[1] = LeanVector<int>(fromLean);
+    bool interopTest = (fromLean.Size() == 5 && fromLean[4] == 10 && setFromLean.Size() == 3 && setFromLean.Min() == 6 &&
+                        moved.Size() == 5 && row.Empty() && adjacency[1].Size() == 5 && adjacency[0].Empty());
+    printTestResult("LeanVector <-> TraversableContainer interoperability", interopTest);
+
+    allTestsPassed &= (footprintTest && apiTest && interopTest);
+    cout << "Overall lean vector result: " << (allTestsPassed ? "SUCCESS" : "FAILURE") << endl;
+}
+
+void testUncheckedAccess() {
+    cout << "\n=== Unchecked Access Test ===" << endl;
+    bool allTestsPassed = true;
+
+    Vector<int> vec(6);
+    List<int> lst;
+    for (unsigned long i = 0; i < 6; i++) {
+        vec[i] = static_cast<int>(i * i);
+        lst.InsertAtBack(static_cast<int>(i * i));
+    }
+    const Vector<int>& constVec = vec;
+    bool vectorTest = (vec.UncheckedFront() == vec.Front() && vec.UncheckedBack() == vec.Back() && constVec.UncheckedAt(3) == constVec[3]);
+    vec.UncheckedAt(2) = 40;
+    vectorTest &= (vec[2] == 40);
+    try {
+        vec[6];
+        vectorTest = false;
+    } catch (const out_of_range&) {}
+    printTestResult("Vector unchecked accessors agree with checked ones", vectorTest);
+
+    const List<int>& constLst = lst;
+    bool listTest = (lst.UncheckedFront() == 0 && lst.UncheckedBack() == 25 && constLst.UncheckedAt(4) == constLst[4]);
+    lst.UncheckedBack() = 7;
+    listTest &= (lst.Back() == 7);
+    printTestResult("List unchecked accessors agree with checked ones", listTest);
+
+    FinalVector<int> finalVec(vec);
+    bool finalTest = (finalVec.UncheckedAt(2) == 40 && finalVec.UncheckedBack() == 25);
+    printTestResult("FinalVector inherits the unchecked accessors", finalTest);
+
+    SortableVector<int> sortable(200);
+    SetVec<int> set;
+    for (unsigned long i = 0; i < 200; i++) {
+        sortable[i] = static_cast<int>((i * 37) % 200);
+        set.Insert(static_cast<int>((i * 53) % 200));
+    }
+    sortable.Sort();
+    bool internalTest = (set.Size() == 200 && set.Exists(0) && set.Exists(199) && !set.Exists(200) && set.Predecessor(100) == 99);
+    for (unsigned long i = 0; i < 200; i++) {
+        internalTest &= (sortable[i] == static_cast<int>(i) && set[i] == static_cast<int>(i));
+    }
+    printTestResult("SetVec search and SortableVector partition on the unchecked path", internalTest);
+
+    allTestsPassed &= (vectorTest && listTest && finalTest && internalTest);
+    cout << "Overall unchecked access result: " << (allTestsPassed ? "SUCCESS" : "FAILURE") << endl;
+}
+
+// Element whose std::hash counts its calls, to check that the container hashes are cached
+struct HashCounted {
+    int value = 0;
+    static inline unsigned long hashCalls = 0;
+
+    auto operator<=>(const HashCounted&) const = default;
+};
+
+template <>
+struct std::hash<HashCounted> {
+    size_t operator()(const HashCounted& element) const noexcept {
+        HashCounted::hashCalls++;
+        return std::hash<int>{}(element.value);
+    }
+};
+
+void testContentHash() {
+    cout << "\n=== Content Hash Test ===" << endl;
+    bool allTestsPassed = true;
+
+    Vector<int> vec(5);
+    for (unsigned long i = 0; i < 5; i++) {
+        vec[i] = static_cast<int>(i * 3);
+    }
+    Vector<int> same(vec);
+    SortableVector<int> shuffled(5);
+    for (unsigned long i = 0; i < 5; i++) {
+        shuffled[i] = static_cast<int>((4 - i) * 3);
+    }
+    bool sequenceTest = (vec.Hash() == same.Hash() && std::hash<Vector<int>>{}(vec) == vec.Hash() && shuffled.Hash() != vec.Hash());
+    shuffled.Sort();
+    sequenceTest &= (shuffled.Hash() == vec.Hash());
+    vec[2] = 100;
+    sequenceTest &= (vec.Hash() != same.Hash());
+    vec.Map([](int& x) { x = (x == 100) ? 6 : x; });
+    sequenceTest &= (vec.Hash() == same.Hash());
+    List<int> lst(vec);
+    List<int> grown;
+    grown.Hash();
+    for (unsigned long i = 0; i < 5; i++) {
+        grown.InsertAtBack(vec[i]); // Estende la hash gia' calcolata
+    }
+    sequenceTest &= (grown.Hash() == lst.Hash() && std::hash<List<int>>{}(lst) == lst.Hash());
+    grown.RemoveFromFront();
+    grown.InsertAtFront(0);
+    sequenceTest &= (grown.Hash() == lst.Hash());
+    // Scritture attraverso iteratori e riferimenti presi prima di Hash(): servono InvalidateHash()
+    int* first = vec.begin();
+    int& front = grown.Front();
+    size_t vecBefore = vec.Hash();
+    size_t grownBefore = grown.Hash();
+    *first = 42;
+    front = 42;
+    sequenceTest &= (vec.Hash() == vecBefore && grown.Hash() == grownBefore);
+    vec.InvalidateHash();
+    grown.InvalidateHash();
+    sequenceTest &= (vec.Hash() != vecBefore && grown.Hash() != grownBefore && vec.Hash() == Vector<int>(vec).Hash() &&
+                     grown.Hash() == List<int>(grown).Hash());
+    printTestResult("Sequence hash follows the contents and their order", sequenceTest);
+
+    SetVec<int> setVec;
+    SetLst<int> setLst;
+    for (int x : {5, 1, 9, 3, 7}) {
+        setVec.Insert(x);
+        setLst.Insert(x);
+    }
+    size_t vecHash = setVec.Hash();
+    size_t lstHash = setLst.Hash();
+    bool setTest = (vecHash == lstHash);
+    setVec.Insert(4);
+    setLst.Insert(4);
+    setVec.Remove(4);
+    setLst.Remove(4);
+    setTest &= (setVec.Hash() == vecHash && setLst.Hash() == lstHash);
+    setTest &= (setVec.MinNRemove() == 1 && setLst.MaxNRemove() == 9 && setVec.PredecessorNRemove(6) == 5 && setLst.SuccessorNRemove(2) == 3);
+    SetVec<int> rebuiltVec(setVec);
+    SetLst<int> rebuiltLst(setLst);
+    rebuiltVec.Clear();
+    for (int x : {9, 7, 3}) {
+        rebuiltVec.Insert(x);
+    }
+    setTest &= (setVec.Hash() == rebuiltVec.Hash() && setLst.Hash() == SetLst<int>(rebuiltLst).Hash());
+    setLst.RemovePredecessor(5);
+    setLst.RemoveSuccessor(5);
+    SetLst<int> single;
+    single.Insert(5);
+    setTest &= (setLst.Hash() == single.Hash() && std::hash<SetLst<int>>{}(setLst) == single.Hash());
+    unordered_set<SetVec<int>> shards;
+    shards.insert(setVec);
+    shards.insert(rebuiltVec);
+    setTest &= (shards.size() == 1);
+    printTestResult("Set hash is order-independent and updated by Insert/Remove", setTest);
+
+    HashCounted::hashCalls = 0;
+    SetVec<HashCounted> counted;
+    for (int i = 0; i < 100; i++) {
+        counted.Insert(HashCounted{i});
+    }
+    counted.Hash();
+    unsigned long afterFirst = HashCounted::hashCalls;
+    counted.Hash();
+    counted.Hash();
+    bool cacheTest = (afterFirst == 100 && HashCounted::hashCalls == afterFirst);
+    counted.Insert(HashCounted{1000});
+    counted.Remove(HashCounted{0});
+    counted.RemoveMax();
+    size_t incremental = counted.Hash();
+    cacheTest &= (HashCounted::hashCalls == afterFirst + 3);
+    cacheTest &= (incremental == SetVec<HashCounted>(counted).Hash());
+    HashCounted::hashCalls = 0;
+    cacheTest &= (counted.RemoveIf([](const HashCounted& element) { return element.value <= 10; }) == 10);
+    incremental = counted.Hash();
+    cacheTest &= (HashCounted::hashCalls == 10);
+    cacheTest &= (incremental == SetVec<HashCounted>(counted).Hash());
+    FinalList<HashCounted> countedList;
+    countedList.Hash();
+    HashCounted::hashCalls = 0;
+    for (int i = 0; i < 50; i++) {
+        countedList.EmplaceAtBack(HashCounted{i});
+    }
+    countedList.Hash();
+    countedList.Hash();
+    cacheTest &= (HashCounted::hashCalls == 50);
+    printTestResult("Hash of an unchanged container is cached (one element hash per update)", cacheTest);
+
+    allTestsPassed &= (sequenceTest && setTest && cacheTest);
+    cout << "Overall content hash result: " << (allTestsPassed ? "SUCCESS" : "FAILURE") << endl;
+}
+
+void testRemoveIf() {
+    cout << "\n=== RemoveIf Test ===" << endl;
+    bool allTestsPassed = true;
+
+    auto isEven = [](const int& x) { return x % 2 == 0; };
+
+    Vector<int> vec(10);
+    for (unsigned long i = 0; i < 10; i++) {
+        vec[i] = static_cast<int>(i);
+    }
+    bool vectorTest = (vec.RemoveIf(isEven) == 5 && vec.Size() == 5);
+    for (unsigned long i = 0; i < vec.Size(); i++) {
+        vectorTest &= (vec[i] == static_cast<int>(2 * i + 1));
+    }
+    vectorTest &= (vec.RemoveIf(isEven) == 0 && vec.Size() == 5 && vec.RemoveIf([](const int&) { return true; }) == 5 && vec.Empty());
+    Vector<unique_ptr<int>> owners(6);
+    for (unsigned long i = 0; i < 6; i++) {
+        owners[i] = make_unique<int>(static_cast<int>(i));
+    }
+    vectorTest &= (owners.RemoveIf([](const unique_ptr<int>& p) { return *p >= 2 && *p <= 3; }) == 2 && owners.Size() == 4 && *owners[2] == 4 && *owners[3] == 5);
+    printTestResult("Vector RemoveIf: stable compaction, count, move-only data", vectorTest);
+
+    Vector<int> partial(6);
+    for (unsigned long i = 0; i < 6; i++) {
+        partial[i] = static_cast<int>(i);
+    }
+    bool exceptionTest = false;
+    try {
+        partial.RemoveIf([](const int& x) {
+            if (x == 3) {
+                throw runtime_error("predicate failure");
+            }
+            return x == 1;
+        });
+    } catch (const runtime_error&) {
+        exceptionTest = (partial.Size() == 5 && partial[0] == 0 && partial[1] == 2 && partial[2] == 3 && partial[4] == 5);
+    }
+    printTestResult("Vector RemoveIf: a throwing predicate removes only what it judged", exceptionTest);
+
+    List<int> lst;
+    for (int i = 0; i < 10; i++) {
+        lst.InsertAtBack(i);
+    }
+    bool listTest = (lst.RemoveIf([](const int& x) { return x == 0 || x == 9 || x % 3 == 0; }) == 4 && lst.Size() == 6 &&
+                     lst.Front() == 1 && lst.Back() == 8);
+    lst.InsertAtBack(20);
+    listTest &= (lst.Back() == 20 && lst[6] == 20 && lst[2] == 4);
+    listTest &= (lst.RemoveIf([](const int&) { return true; }) == 7 && lst.Empty());
+    lst.InsertAtBack(1);
+    listTest &= (lst.Front() == 1 && lst.Back() == 1);
+    printTestResult("List RemoveIf: one walk, head and tail kept consistent", listTest);
+
+    SetVec<int> setVec;
+    SetLst<int> setLst;
+    for (int i = 0; i < 50; i++) {
+        setVec.Insert((i * 17) % 50);
+        setLst.Insert((i * 17) % 50);
+    }
+    setVec.Hash();
+    setLst.Hash();
+    bool setTest = (setVec.RemoveIf(isEven) == 25 && setLst.RemoveIf(isEven) == 25 && setVec.Size() == 25 && setLst.Size() == 25);
+    for (unsigned long i = 0; i < 25; i++) {
+        setTest &= (setVec[i] == static_cast<int>(2 * i + 1) && setLst[i] == static_cast<int>(2 * i + 1));
+    }
+    setTest &= (setVec.Exists(49) && !setVec.Exists(48) && setVec.Insert(48) && setVec.Predecessor(49) == 48 && setVec.Remove(48));
+    setTest &= (setVec.Hash() == SetVec<int>(setLst).Hash() && setLst.Hash() == SetLst<int>(setVec).Hash());
+    printTestResult("SetVec/SetLst RemoveIf: ordered result and updated hash", setTest);
+
+    allTestsPassed &= (vectorTest && exceptionTest && listTest && setTest);
+    cout << "Overall RemoveIf result: " << (allTestsPassed ? "SUCCESS" : "FAILURE") << endl;
+}
+
+// Memory resource that counts what goes through it (and forwards to the heap)
+class CountingResource : public std::pmr::memory_resource {
+public:
+    unsigned long allocations = 0;
+    unsigned long deallocations = 0;
+
+private:
+    void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+        allocations++;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void *pointer, std::size_t bytes, std::size_t alignment) override {
+        deallocations++;
+        std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override {
+        return this == &other;
+    }
+};
+
+// Dato il cui spostamento numero failAt lancia
+struct FragileMove {
+    static inline int moves = 0;
+    static inline int failAt = -1;
+    int value = 0;
+
+    FragileMove() = default;
+    explicit FragileMove(int v) : value(v) {}
+
+    FragileMove(FragileMove&& other) : value(other.value) {
+        if (moves++ == failAt) {
+            throw runtime_error("move failure");
+        }
+    }
+
+    FragileMove& operator=(FragileMove&&) = default;
+    bool operator==(const FragileMove& other) const noexcept { return value == other.value; }
+};
+
+void testMemoryResources() {
+    cout << "\n=== Memory Resource Test ===" << endl;
+    bool allTestsPassed = true;
+
+    CountingResource counting;
+    bool vectorTest;
+    {
+        Vector<int> vec(8, counting);
+        for (unsigned long i = 0; i < 8; i++) {
+            vec[i] = static_cast<int>(i);
+        }
+        vec.Resize(16);
+        vectorTest = (vec.Resource() == &counting && counting.allocations == 2 && counting.deallocations == 1);
+
+        Vector<int> copy(vec);
+        Vector<int> sameResource(vec, counting);
+        vectorTest &= (copy.Resource() == std::pmr::get_default_resource() && sameResource.Resource() == &counting &&
+                       counting.allocations == 3 && copy == vec && sameResource == vec);
+
+        Vector<int> moved(std::move(sameResource));
+        vectorTest &= (moved.Resource() == &counting && counting.allocations == 3 && moved[7] == 7);
+
+        copy = vec; // La copia mantiene la propria risorsa
+        vectorTest &= (copy.Resource() == std::pmr::get_default_resource() && counting.allocations == 3);
+    }
+    vectorTest &= (counting.allocations == counting.deallocations);
+    printTestResult("Vector: storage from the resource, std::pmr copy and move rules", vectorTest);
+
+    CountingResource other;
+    bool crossTest;
+    {
+        Vector<unique_ptr<int>> source(3, other);
+        for (unsigned long i = 0; i < 3; i++) {
+            source[i] = make_unique<int>(static_cast<int>(i));
+        }
+        Vector<unique_ptr<int>> target(counting);
+        target = std::move(source); // Risorse diverse: si spostano gli elementi, non il blocco
+        crossTest = (target.Resource() == &counting && target.Size() == 3 && *target[2] == 2 && source.Empty() &&
+                     other.allocations == 1 && other.deallocations == 1);
+
+        List<int> lstSource(other);
+        List<int> lstTarget(counting);
+        for (int i = 0; i < 4; i++) {
+            lstSource.InsertAtBack(i);
+        }
+        lstTarget = std::move(lstSource);
+        crossTest &= (lstTarget.Resource() == &counting && lstTarget.Size() == 4 && lstTarget.Back() == 3 && lstSource.Empty() &&
+                      other.allocations == other.deallocations);
+    }
+    crossTest &= (counting.allocations == counting.deallocations);
+    {
+        // Due arene distinte: gli elementi devono finire nel buffer della destinazione
+        static_assert(!is_nothrow_move_assignable_v<Vector<string>> && !is_nothrow_move_assignable_v<List<string>>);
+        alignas(std::max_align_t) std::byte sourceBuffer[4096];
+        alignas(std::max_align_t) std::byte targetBuffer[4096];
+        std::pmr::monotonic_buffer_resource sourceArena(sourceBuffer, sizeof(sourceBuffer), std::pmr::null_memory_resource());
+        std::pmr::monotonic_buffer_resource targetArena(targetBuffer, sizeof(targetBuffer), std::pmr::null_memory_resource());
+        auto inTarget = [&](const void* address) {
+            return address >= targetBuffer && address < targetBuffer + sizeof(targetBuffer);
+        };
+
+        Vector<string> vecSource(3, sourceArena);
+        for (unsigned long i = 0; i < 3; i++) {
+            vecSource[i] = to_string(i);
+        }
+        Vector<string> vecTarget(1, targetArena);
+        vecTarget = std::move(vecSource);
+        crossTest &= (vecTarget.Resource() == &targetArena && vecTarget.Size() == 3 && vecTarget[2] == "2" &&
+                      inTarget(&vecTarget[0]) && vecSource.Empty());
+
+        List<string> lstSource(sourceArena);
+        List<string> lstTarget(targetArena);
+        for (int i = 0; i < 4; i++) {
+            lstSource.InsertAtBack(to_string(i));
+        }
+        lstTarget = std::move(lstSource);
+        crossTest &= (lstTarget.Resource() == &targetArena && lstTarget.Size() == 4 && lstTarget.Back() == "3" &&
+                      inTarget(&lstTarget.Front()) && inTarget(&lstTarget.Back()) && lstSource.Empty());
+    }
+    printTestResult("Move assignment across different resources moves the elements", crossTest);
+
+    bool throwingTest = false;
+    {
+        CountingResource source;
+        CountingResource target;
+        Vector<FragileMove> from(3, source);
+        Vector<FragileMove> to(2, target);
+        for (unsigned long i = 0; i < 3; i++) {
+            from[i].value = static_cast<int>(i);
+        }
+        FragileMove::moves = 0;
+        FragileMove::failAt = 1;
+        try {
+            to = std::move(from);
+        } catch (const runtime_error&) {
+            // Il blocco preso per gli elementi spostati torna alla risorsa, la destinazione resta com'era
+            throwingTest = (target.allocations == 2 && target.deallocations == 1 && to.Size() == 2 && from.Size() == 3 &&
+                            from[2].value == 2);
+        }
+        FragileMove::failAt = -1;
+    }
+    printTestResult("Move assignment across resources releases its block when a move throws", throwingTest);
+
+    unsigned long before = counting.allocations;
+    bool nodeTest;
+    {
+        List<int> lst(counting);
+        for (int i = 0; i < 10; i++) {
+            lst.InsertAtBack(i);
+        }
+        lst.RemoveFromFront();
+        nodeTest = (counting.allocations - before == 10 && lst.Resource() == &counting);
+
+        List<int> copy(lst);
+        List<int> moved(std::move(lst));
+        nodeTest &= (copy.Resource() == &NodePool::Default() && moved.Resource() == &counting &&
+                     counting.allocations - before == 10 && moved.Size() == 9 && copy == moved);
+    }
+    nodeTest &= (counting.allocations == counting.deallocations);
+    printTestResult("List: one node per allocation from the resource", nodeTest);
+
+    std::pmr::monotonic_buffer_resource arena;
+    std::pmr::unsynchronized_pool_resource pool;
+    SetVec<int> setVec(arena);
+    SetLst<int> setLst(pool);
+    for (int i = 0; i < 100; i++) {
+        setVec.Insert((i * 37) % 100);
+        setLst.Insert((i * 37) % 100);
+    }
+    Vector<int> values(5);
+    for (unsigned long i = 0; i < 5; i++) {
+        values[i] = static_cast<int>(4 - i);
+    }
+    SetLst<int> fromContainer(values, counting);
+    bool setTest = (setVec.Resource() == &arena && setLst.Resource() == &pool && setVec.Size() == 100 && setLst.Size() == 100 &&
+                    setVec.Min() == 0 && setLst.Max() == 99 && SetLst<int>(setVec) == setLst &&
+                    fromContainer.Resource() == &counting && fromContainer.Min() == 0 && fromContainer.Size() == 5);
+    setTest &= (setVec.Remove(50) && setLst.Remove(50) && !setVec.Exists(50) && setLst.Successor(49) == 51);
+    printTestResult("SetVec/SetLst with monotonic and pool resources", setTest);
+
+    allTestsPassed &= (vectorTest && crossTest && throwingTest && nodeTest && setTest);
+    cout << "Overall memory resource result: " << (allTestsPassed ? "SUCCESS" : "FAILURE") << endl;
+}
+
+void testNodePool() {
+    cout << "\n=== Node Pool Test ===" << endl;
+    bool allTestsPassed = true;
+
+    CountingResource upstream;
+    bool recycleTest, slabTest, upstreamTest;
+    {
+        NodePool pool(upstream);
+        List<int> lst(pool);
+        for (int i = 0; i < 100; i++) {
+            lst.InsertAtBack(i);
+        }
+        const unsigned long perSlab = 100 + pool.FreeCount();
+        recycleTest = (pool.SlabCount() == 1 && upstream.allocations == 1 && pool.InUse() == 100 && perSlab > 100);
+
+        for (int i = 0; i < 50; i++) {
+            lst.RemoveFromFront();
+        }
+        recycleTest &= (pool.InUse() == 50 && pool.FreeCount() == perSlab - 50);
+        for (int i = 0; i < 50; i++) {
+            lst.InsertAtFront(i); // I nodi rimossi tornano in uso senza nuove allocazioni
+        }
+        recycleTest &= (pool.SlabCount() == 1 && upstream.allocations == 1 && lst.Size() == 100 && lst.Back() == 99);
+        printTestResult("Removed nodes are recycled from the free list", recycleTest);
+
+        for (unsigned long i = 0; i < perSlab; i++) {
+            lst.InsertAtBack(static_cast<int>(i));
+        }
+        slabTest = (pool.SlabCount() == 2 && upstream.allocations == 2 && pool.InUse() == 100 + perSlab);
+        SetLst<string> names(pool); // Altra dimensione di nodo, altra classe e altra slab
+        names.Insert("node");
+        names.Insert("pool");
+        slabTest &= (pool.SlabCount() == 3 && pool.InUse() == 102 + perSlab && names.Exists("pool") && names.Resource() == &pool);
+        lst.Clear();
+        names.Clear();
+        slabTest &= (pool.InUse() == 0 && pool.SlabCount() == 3 && pool.FreeCount() > 2 * perSlab); // Le slab restano al pool
+        printTestResult("Slabs are taken in bulk per size class", slabTest);
+
+        void *large = pool.allocate(1024, alignof(int));
+        void *aligned = pool.allocate(64, 64);
+        upstreamTest = (!NodePool::Pooled(1024, alignof(int)) && !NodePool::Pooled(64, 64) && NodePool::Pooled(24, 8) &&
+                        upstream.allocations == 5 && reinterpret_cast<std::uintptr_t>(aligned) % 64 == 0 && pool.InUse() == 2);
+        pool.deallocate(aligned, 64, 64);
+        pool.deallocate(large, 1024, alignof(int));
+        upstreamTest &= (pool.InUse() == 0 && upstream.deallocations == 2);
+
+        List<int> pending(pool);
+        pending.InsertAtBack(1);
+        upstreamTest &= (!pool.Release() && pool.SlabCount() == 3);
+        pending.Clear();
+        upstreamTest &= (pool.Release() && pool.SlabCount() == 0 && pool.FreeCount() == 0 && upstream.deallocations == 5);
+        pending.InsertAtBack(2);
+        upstreamTest &= (pool.SlabCount() == 1 && pending.Front() == 2);
+    }
+    upstreamTest &= (upstream.allocations == upstream.deallocations);
+    printTestResult("Large or over-aligned blocks go upstream, slabs return on Release and destruction", upstreamTest);
+
+    bool trimTest;
+    {
+        NodePool pool(upstream, 2);
+        List<int> lst(pool);
+        lst.InsertAtBack(0);
+        const unsigned long perSlab = 1 + pool.FreeCount();
+        for (unsigned long i = 1; i < 4 * perSlab; i++) {
+            lst.InsertAtBack(static_cast<int>(i));
+        }
+        const unsigned long released = upstream.deallocations;
+        trimTest = (pool.SlabCount() == 4 && pool.IdleSlabCount() == 0);
+        lst.Clear(); // Alla terza slab inattiva il pool torna a una sola
+        trimTest &= (pool.SlabCount() == 2 && pool.IdleSlabCount() == 2 && upstream.deallocations == released + 2 &&
+                     pool.FreeCount() == 2 * perSlab);
+
+        lst.InsertAtBack(1);
+        trimTest &= (pool.Trim() == 1 && pool.SlabCount() == 1 && pool.IdleSlabCount() == 0 && pool.FreeCount() == perSlab - 1);
+        for (unsigned long i = 0; i < perSlab; i++) {
+            lst.InsertAtBack(static_cast<int>(i));
+        }
+        trimTest &= (pool.SlabCount() == 2 && pool.InUse() == perSlab + 1 && lst.Size() == perSlab + 1 && lst.Back() == static_cast<int>(perSlab - 1));
+    }
+    trimTest &= (upstream.allocations == upstream.deallocations);
+    printTestResult("Idle slabs return upstream past the limit and on Trim", trimTest);
+
+    List<int> byDefault;
+    SetLst<int> setByDefault;
+    NodePool *mainPool = &NodePool::Local();
+    NodePool *threadPool = nullptr;
+    List<int> *fromThread = nullptr;
+    std::thread worker([&]() {
+        threadPool = &NodePool::Local();
+        fromThread = new List<int>();
+        for (int i = 0; i < 10; i++) {
+            fromThread->InsertAtBack(i);
+        }
+    });
+    worker.join();
+    // Il pool del thread terminato resta valido finché la lista non restituisce i suoi nodi
+    bool localTest = (byDefault.Resource() == &NodePool::Default() && setByDefault.Resource() == &NodePool::Default() && threadPool != mainPool &&
+                      fromThread->Resource() == &NodePool::Default() && &ThreadNodePool::OwnerOf(&fromThread->Front()) == threadPool &&
+                      threadPool->InUse() == 10 && fromThread->Size() == 10 && fromThread->Back() == 9);
+    fromThread->RemoveFromFront();
+    localTest &= (threadPool->InUse() == 9);
+    delete fromThread;
+    printTestResult("Thread-local default pool outlives its thread while nodes are in use", localTest);
+
+    // Una lista del thread principale svuotata e riempita da un altro thread mentre il principale alloca:
+    // i nodi liberati altrove tornano al pool che li ha ritagliati
+    const unsigned long mainInUse = NodePool::Local().InUse();
+    List<int> shared;
+    for (int i = 0; i < 1000; i++) {
+        shared.InsertAtBack(i);
+    }
+    std::atomic<bool> started{false};
+    std::thread other([&]() {
+        started = true;
+        while (!shared.Empty()) {
+            shared.RemoveFromFront();
+        }
+        for (int i = 0; i < 1000; i++) {
+            shared.InsertAtBack(i);
+        }
+    });
+    List<int> churn;
+    while (!started) {
+    }
+    for (int i = 0; i < 100000; i++) {
+        churn.InsertAtBack(i);
+        churn.RemoveFromFront();
+    }
+    other.join();
+    churn.InsertAtBack(0); // Riprende i nodi restituiti dall'altro thread
+    bool crossTest = (NodePool::Local().InUse() == mainInUse + 1 && &ThreadNodePool::OwnerOf(&shared.Front()) != mainPool &&
+                      shared.Size() == 1000 && shared.Front() == 0 && shared.Back() == 999);
+    shared.Clear(); // Nodi del pool di un thread terminato: l'ultimo lo distrugge
+    crossTest &= (NodePool::Local().InUse() == mainInUse + 1);
+    printTestResult("Default pool: nodes freed on another thread go back to their own pool", crossTest);
+
+    allTestsPassed &= (recycleTest && slabTest && upstreamTest && trimTest && localTest && crossTest);
+    cout << "Overall node pool result: " << (allTestsPassed ? "SUCCESS" : "FAILURE") << endl;
+}
+
+void testArenaMode() {
+    cout << "\n=== Arena Mode Test ===" << endl;
+    bool allTestsPassed = true;
+
+    // Le regioni delle arene vengono dalla risorsa di default: qui la si conta
+    CountingResource upstream;
+    std::pmr::memory_resource *previous = std::pmr::set_default_resource(&upstream);
+    bool regionTest;
+    {
+        const unsigned long poolInUse = NodePool::Local().InUse();
+        List<int> lst(ArenaMode{});
+        for (int i = 0; i < 10000; i++) {
+            lst.InsertAtBack(i);
+        }
+        const unsigned long chunks = upstream.allocations;
+        regionTest = (lst.OwnsArena() && lst.Resource() != &NodePool::Local() && NodePool::Local().InUse() == poolInUse &&
+                      chunks > 0 && chunks < 20 && lst.Size() == 10000 && lst.Back() == 9999);
+
+        lst.Clear(); // Tutta la regione torna indietro, senza visitare i nodi
+        regionTest &= (lst.Empty() && upstream.deallocations == chunks && lst.OwnsArena());
+        lst.InsertAtFront(7);
+        lst.InsertAtBack(8);
+        regionTest &= (lst.Size() == 2 && lst.Front() == 7 && lst.Back() == 8 && lst.Fold([](const int& x, const int& acc) { return acc + x; }, 0) == 15);
+    }
+    regionTest &= (upstream.allocations == upstream.deallocations);
+    std::pmr::set_default_resource(previous);
+    printTestResult("Arena List: nodes from one region, released whole by Clear and destructor", regionTest);
+
+    List<int> source(ArenaMode{});
+    List<int> plain;
+    for (int i = 0; i < 5; i++) {
+        source.InsertAtBack(i);
+        plain.InsertAtBack(10 + i);
+    }
+    List<int> copy(source);
+    bool ownershipTest = (copy.OwnsArena() && copy.Resource() != source.Resource() && copy == source);
+    List<int> moved(std::move(source));
+    ownershipTest &= (moved.OwnsArena() && !source.OwnsArena() && source.Resource() == &NodePool::Default() && source.Empty() &&
+                      moved.Size() == 5);
+    source.InsertAtBack(1);
+    std::pmr::memory_resource *copyArena = copy.Resource();
+    copy = std::move(moved); // Due arene: si scambiano
+    ownershipTest &= (copy.Resource() != copyArena && moved.Resource() == copyArena && copy.Size() == 5 && moved.Size() == 5);
+    copy = std::move(plain); // Da lista senza arena: gli elementi entrano nell'arena
+    ownershipTest &= (copy.OwnsArena() && copy.Size() == 5 && copy.Front() == 10 && plain.Empty() && !plain.OwnsArena());
+    printTestResult("Arena mode follows copies and moves", ownershipTest);
+
+    bool destructorTest;
+    {
+        List<unique_ptr<int>> owners(ArenaMode{});
+        List<string> names(ArenaMode{});
+        for (int i = 0; i < 50; i++) {
+            owners.InsertAtBack(make_unique<int>(i));
+            names.InsertAtBack("arena element number " + to_string(i));
+        }
+        owners.RemoveFromFront();
+        destructorTest = (owners.Size() == 49 && *owners.Front() == 1 && names.Back() == "arena element number 49");
+        names.Clear(); // I distruttori non banali vengono comunque chiamati
+        names.InsertAtBack("again");
+        destructorTest &= (names.Size() == 1 && names.Front() == "again");
+    }
+    printTestResult("Arena mode still destroys non-trivial elements", destructorTest);
+
+    SetLst<int> set(ArenaMode{});
+    for (int i = 0; i < 200; i++) {
+        set.Insert((i * 7) % 200);
+    }
+    SetLst<int> setCopy(set);
+    bool setTest = (set.OwnsArena() && setCopy.OwnsArena() && setCopy == set && set.Min() == 0 && set.Max() == 199 &&
+                    set.Remove(100) && !set.Exists(100) && set.Successor(99) == 101);
+    set.Clear();
+    setTest &= (set.Empty() && set.Insert(3) && set.Size() == 1 && setCopy.Size() == 200);
+    printTestResult("SetLst in arena mode", setTest);
+
+    allTestsPassed &= (regionTest && ownershipTest && destructorTest && setTest);
+    cout << "Overall arena mode result: " << (allTestsPassed ? "SUCCESS" : "FAILURE") << endl;
+}
+
+// Dato copiabile il cui spostamento può lanciare: Compact() lo copia, e la copia numero failAt lancia
+struct FragileCopy {
+    static inline int copies = 0;
+    static inline int failAt = -1;
+    int value = 0;
+
+    FragileCopy() = default;
+    explicit FragileCopy(int v) : value(v) {}
+
+    FragileCopy(const FragileCopy& other) : value(other.value) {
+        if (copies++ == failAt) {
+            throw runtime_error("copy failure");
+        }
+    }
+
+    FragileCopy(FragileCopy&& other) : value(other.value) {}
+
+    FragileCopy& operator=(const FragileCopy&) = default;
+    bool operator==(const FragileCopy& other) const noexcept { return value == other.value; }
+};
+
+template <typename ListType>
+bool NodesContiguous(const ListType& lst) {
+    // Le distanze tra elementi consecutivi sono tutte uguali e positive (un solo blocco, in ordine)
+    std::ptrdiff_t step = 0;
+    auto previous = lst.begin();
+    for (auto current = std::next(previous); current != lst.end(); previous = current++) {
+        std::ptrdiff_t distance = reinterpret_cast<const char*>(&*current) - reinterpret_cast<const char*>(&*previous);
+        if (distance <= 0 || (step != 0 && distance != step)) {
+            return false;
+        }
+        step = distance;
+    }
+    return true;
+}
+
+void testCompact() {
+    cout << "\n=== Compact Test ===" << endl;
+    bool allTestsPassed = true;
+
+    CountingResource counting;
+    bool orderTest, mutationTest;
+    {
+        List<int> lst(counting);
+        for (int i = 0; i < 1000; i++) {
+            (i % 2 == 0) ? lst.InsertAtBack(i) : lst.InsertAtFront(i);
+        }
+        lst.RemoveIf([](const int& x) { return x % 3 == 0; });
+        Vector<int> before(lst);
+        const std::size_t hash = lst.Hash();
+
+        lst.Compact();
+        orderTest = (NodesContiguous(lst) && Vector<int>(lst) == before && lst.Hash() == hash && lst.Size() == before.Size() &&
+                     lst.Front() == before[0] && lst.Back() == before[before.Size() - 1]);
+        printTestResult("Compact keeps order, values and hash, nodes become contiguous", orderTest);
+
+        lst.InsertAtBack(-1);
+        lst.InsertAtFront(-2);
+        lst.RemoveFromFront();
+        lst.RemoveFromFront(); // Un nodo del blocco
+        lst.RemoveIf([](const int& x) { return x % 7 == 0; });
+        mutationTest = (lst.Back() == -1 && lst.Front() == before[1]);
+        lst.Compact(); // Il blocco precedente si svuota e torna alla risorsa
+        mutationTest &= (NodesContiguous(lst) && lst.Back() == -1 && counting.allocations - counting.deallocations == 1);
+
+        List<int> moved(std::move(lst)); // Il blocco segue i nodi
+        moved.Clear();
+        mutationTest &= (counting.allocations == counting.deallocations && lst.Empty());
+        moved.InsertAtBack(4);
+        moved.Compact();
+        mutationTest &= (moved.Front() == 4 && moved.Size() == 1);
+    }
+    mutationTest &= (counting.allocations == counting.deallocations);
+    printTestResult("Inserts and removals after Compact, block freed with its last node", mutationTest);
+
+    List<FragileCopy> fragile;
+    for (int i = 0; i < 10; i++) {
+        fragile.InsertAtBack(FragileCopy(i));
+    }
+    const FragileCopy* front = &fragile.Front();
+    const FragileCopy* middle = &fragile[6];
+    FragileCopy::copies = 0;
+    FragileCopy::failAt = 6;
+    bool exceptionTest = false;
+    try {
+        fragile.Compact();
+    } catch (const runtime_error&) {
+        // Gli stessi nodi di prima, non un blocco parziale
+        exceptionTest = (fragile.Size() == 10 && &fragile.Front() == front && &fragile[6] == middle && fragile.Front().value == 0 &&
+                         fragile.Back().value == 9 && fragile[6].value == 6);
+    }
+    FragileCopy::failAt = -1;
+    fragile.Compact();
+    exceptionTest &= (NodesContiguous(fragile) && fragile[6].value == 6);
+    printTestResult("Compact leaves the list untouched when a copy throws", exceptionTest);
+
+    List<unique_ptr<int>> owners;
+    SetLst<int> set;
+    List<int> arenaList(ArenaMode{});
+    for (int i = 0; i < 100; i++) {
+        owners.InsertAtFront(make_unique<int>(i));
+        set.Insert((i * 31) % 100);
+        arenaList.InsertAtFront(i);
+    }
+    owners.Compact();
+    set.Compact();
+    arenaList.Compact();
+    bool otherTest = (NodesContiguous(owners) && *owners.Front() == 99 && *owners.Back() == 0 && NodesContiguous(set) &&
+                      set.Min() == 0 && set.Max() == 99 && set.Successor(41) == 42 && set.Remove(42) && !set.Exists(42) &&
+                      set.Insert(42) && set.Exists(42) && NodesContiguous(arenaList) && arenaList.Front() == 99);
+    arenaList.Clear();
+    arenaList.InsertAtBack(1);
+    otherTest &= (arenaList.Size() == 1 && arenaList.Front() == 1);
+    printTestResult("Compact on move-only data, SetLst and arena lists", otherTest);
+
+    allTestsPassed &= (orderTest && mutationTest && exceptionTest && otherTest);
+    cout << "Overall compact result: " << (allTestsPassed ? "SUCCESS" : "FAILURE") << endl;
+}
+
+void runExtensionTests() {
+    cout << "\n======= TESTS FOR LIBRARY EXTENSIONS =======" << endl;
+
+    testShortCircuitTraversal<Vector<int>>("Vector");
+    testShortCircuitTraversal<List<int>>("List");
+    testShortCircuitTraversal<SetLst<int>>("SetLst");
+    testShortCircuitTraversal<SetVec<int>>("SetVec");
+    testDictionaryBulkRemove();
+    testTemplatedCallables<Vector<int>>("Vector");
+    testTemplatedCallables<List<int>>("List");
+    testIterators();
+    testContiguousEquality();
+    testCursorAlgorithms();
+    testTraverseChunks<Vector<int>>("Vector", 1);
+    testTraverseChunks<SetVec<int>>("SetVec", 1);
+    testTraverseChunks<List<int>>("List", 3);
+    testTraverseChunks<SetLst<int>>("SetLst", 3);
+    testLazyViews();
+    testZipAlgorithms();
+    testFoldMove<Vector<int>>("Vector");
+    testFoldMove<List<int>>("List");
+    testFoldMove<SetVec<int>>("SetVec");
+    testFoldMove<SetLst<int>>("SetLst");
+    testRangeOperations<Vector<int>>("Vector");
+    testRangeOperations<List<int>>("List");
+    testNonThrowingLookups<SetVec<int>>("SetVec");
+    testNonThrowingLookups<SetLst<int>>("SetLst");
+    testMoveOutRemoval();
+    testMoveOnlyElements();
+    testEmplace();
+    testHeterogeneousLookup();
+    testComparatorPolicy();
+    testFinalTypes();
+    testLeanVector();
+    testUncheckedAccess();
+    testContentHash();
+    testRemoveIf();
+    testMemoryResources();
+    testNodePool();
+    testArenaMode();
+    testCompact();
+
+    cout << "\n======= END OF EXTENSION TESTS =======" << endl;
+}
+
+
 void runVectorTests() {
     cout << "\n======= TESTS FOR VECTOR CLASS =======" << endl;
 
@@ -1420,7 +3398,8 @@ void mytest() {
              << "3. Test su Set" << endl
              << "4. Test 1,2,3" << endl
              << "5. Test Prof" << endl
-             << "6. Suite Completa" << endl;
+             << "6. Suite Completa" << endl
+             << "7. Test estensioni" << endl;
         string input;
         cin >> input;
         testtype = stoi(input);
@@ -1443,6 +3422,7 @@ void mytest() {
                 runSetLstTests();
                 runSetVecTests();
                 compareSetImplementations();
+                runExtensionTests();
                 break;
             case 5:
                 lasdtest();
@@ -1453,8 +3433,12 @@ void mytest() {
                 runSetLstTests();
                 runSetVecTests();
                 compareSetImplementations();
+                runExtensionTests();
                 lasdtest();
                 break;
+            case 7:
+                runExtensionTests();
+                break;
             default:
                 cout << "Input non valido" << endl;
         }